@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026      High Performance Computing Center Stuttgart,
+ *                         University of Stuttgart.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER NOR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** Benchmark of MPI_Dims_weighted_create_range
+ *
+ * Compares solving all nnodes in [1, nnodes_last] with one call of
+ * MPI_Dims_weighted_create_range against a loop over
+ * MPI_Dims_weighted_create.
+ *
+ * Usage:
+ *   dims_range_bench [nnodes_last] [ndims]    (defaults 65536 3)
+ */
+
+#include "MPI_Dims_weighted_create.h"
+
+#include <mpi.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char *argv[]) {
+  MPI_Init(&argc, &argv);
+
+  int nnodes_last = (argc > 1) ? atoi(argv[1]) : 65536;
+  int ndims = (argc > 2) ? atoi(argv[2]) : 3;
+  if (nnodes_last < 1 || ndims < 1) {
+    fprintf(stderr, "usage: %s [nnodes_last] [ndims]\n", argv[0]);
+    MPI_Finalize();
+    return 1;
+  }
+
+  double *dim_weights = malloc(ndims * sizeof(double));
+  for (int d = 0; d < ndims; d++) {
+    dim_weights[d] = 1. / (d + 1);
+  }
+  int *dims = malloc((size_t)ndims * nnodes_last * sizeof(int));
+  double *objectives = malloc((size_t)nnodes_last * sizeof(double));
+  int *single_dims = malloc(ndims * sizeof(int));
+
+  double t_loop = MPI_Wtime();
+  for (int nnodes = 1; nnodes <= nnodes_last; nnodes++) {
+    for (int d = 0; d < ndims; d++) {
+      single_dims[d] = 0;
+    }
+    MPI_Dims_weighted_create(nnodes, ndims, dim_weights, single_dims);
+  }
+  t_loop = MPI_Wtime() - t_loop;
+
+  double t_range = MPI_Wtime();
+  MPI_Dims_weighted_create_range(1, nnodes_last, ndims, dim_weights, dims,
+                                 objectives);
+  t_range = MPI_Wtime() - t_range;
+
+  printf("nnodes_last,ndims,loop_time,range_time,speedup\n");
+  printf("%d,%d,%g,%g,%g\n", nnodes_last, ndims, t_loop, t_range,
+         t_loop / t_range);
+
+  free(single_dims);
+  free(objectives);
+  free(dims);
+  free(dim_weights);
+  MPI_Finalize();
+  return 0;
+}
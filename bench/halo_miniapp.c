@@ -0,0 +1,373 @@
+/*
+ * Copyright (c) 2026      High Performance Computing Center Stuttgart,
+ *                         University of Stuttgart.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER NOR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** Halo exchange mini-app
+ *
+ * Runs a Jacobi stencil (5-point in 2D, 7-point in 3D) on a global grid with
+ * anisotropic extents, distributed on a Cartesian communicator whose dims are
+ * computed either by MPI_Dims_create or by MPI_Dims_weighted_create with
+ * weights 1/g_i. Every rank reports the bytes it sends per step, the time
+ * spent in the halo exchange and the total step time as one CSV line.
+ *
+ * Usage:
+ *   halo_miniapp -g gx,gy[,gz] [-m dims_create|weighted] [-i iterations]
+ *                [-w halo_width] [-o output.csv] [-H]
+ *
+ *   -g  global grid extents, 2 or 3 values
+ *   -m  method used to compute the process grid (default weighted)
+ *   -i  number of stencil steps (default 100)
+ *   -w  halo width in grid points (default 1)
+ *   -o  append CSV to file instead of writing to stdout
+ *   -H  write CSV header line
+ */
+
+#include "MPI_Dims_weighted_create.h"
+
+#include <mpi.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define MAX_NDIMS 3
+
+enum dims_method { DIMS_CREATE, DIMS_WEIGHTED_CREATE };
+
+static const char *method_names[] = {"dims_create", "weighted"};
+
+struct options {
+  int ndims;
+  int global[MAX_NDIMS];
+  enum dims_method method;
+  int iterations;
+  int halo;
+  const char *output;
+  int header;
+};
+
+static int parse_options(int argc, char *argv[], struct options *opts) {
+  opts->ndims = 0;
+  opts->method = DIMS_WEIGHTED_CREATE;
+  opts->iterations = 100;
+  opts->halo = 1;
+  opts->output = NULL;
+  opts->header = 0;
+
+  int c;
+  while ((c = getopt(argc, argv, "g:m:i:w:o:H")) != -1) {
+    switch (c) {
+    case 'g': {
+      char *str = optarg;
+      opts->ndims = 0;
+      while (*str != '\0' && opts->ndims < MAX_NDIMS) {
+        opts->global[opts->ndims++] = (int)strtol(str, &str, 10);
+        if (*str == ',') {
+          str++;
+        }
+      }
+      if (*str != '\0') {
+        return -1;
+      }
+      break;
+    }
+    case 'm':
+      if (strcmp(optarg, method_names[DIMS_CREATE]) == 0) {
+        opts->method = DIMS_CREATE;
+      } else if (strcmp(optarg, method_names[DIMS_WEIGHTED_CREATE]) == 0) {
+        opts->method = DIMS_WEIGHTED_CREATE;
+      } else {
+        return -1;
+      }
+      break;
+    case 'i':
+      opts->iterations = atoi(optarg);
+      break;
+    case 'w':
+      opts->halo = atoi(optarg);
+      break;
+    case 'o':
+      opts->output = optarg;
+      break;
+    case 'H':
+      opts->header = 1;
+      break;
+    default:
+      return -1;
+    }
+  }
+
+  if (opts->ndims < 2 || opts->iterations < 1 || opts->halo < 1) {
+    return -1;
+  }
+  for (int d = 0; d < opts->ndims; d++) {
+    if (opts->global[d] < 1) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+/** local part of the global grid in a block distribution */
+static void block_range(int global, int nblocks, int block, int *start,
+                        int *size) {
+  int base = global / nblocks;
+  int rest = global % nblocks;
+  *size = base + (block < rest ? 1 : 0);
+  *start = block * base + (block < rest ? block : rest);
+}
+
+int main(int argc, char *argv[]) {
+  MPI_Init(&argc, &argv);
+
+  int size, rank;
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+  struct options opts;
+  if (parse_options(argc, argv, &opts) != 0) {
+    if (rank == 0) {
+      fprintf(stderr,
+              "usage: %s -g gx,gy[,gz] [-m dims_create|weighted] "
+              "[-i iterations] [-w halo_width] [-o output.csv] [-H]\n",
+              argv[0]);
+    }
+    MPI_Finalize();
+    return 1;
+  }
+  const int ndims = opts.ndims;
+
+  int dims[MAX_NDIMS] = {0, 0, 0};
+  int periods[MAX_NDIMS] = {0, 0, 0};
+  if (opts.method == DIMS_CREATE) {
+    MPI_Dims_create(size, ndims, dims);
+  } else {
+    double dim_weights[MAX_NDIMS];
+    for (int d = 0; d < ndims; d++) {
+      dim_weights[d] = 1. / opts.global[d];
+    }
+    MPI_Dims_weighted_create(size, ndims, dim_weights, dims);
+  }
+  for (int d = 0; d < ndims; d++) {
+    if (dims[d] > opts.global[d]) {
+      if (rank == 0) {
+        fprintf(stderr, "process grid exceeds global grid in dimension %d\n",
+                d);
+      }
+      MPI_Finalize();
+      return 1;
+    }
+  }
+
+  MPI_Comm cart;
+  MPI_Cart_create(MPI_COMM_WORLD, ndims, dims, periods, 0, &cart);
+  int coords[MAX_NDIMS];
+  MPI_Cart_coords(cart, rank, ndims, coords);
+
+  /* local grid including halo, last dimension is contiguous */
+  const int h = opts.halo;
+  int local[MAX_NDIMS];
+  int full[MAX_NDIMS];
+  long stride[MAX_NDIMS];
+  long npoints = 1;
+  for (int d = 0; d < ndims; d++) {
+    int start;
+    block_range(opts.global[d], dims[d], coords[d], &start, &local[d]);
+    full[d] = local[d] + 2 * h;
+    npoints *= full[d];
+  }
+  /* inner faces must not reach into the halo, checked on all ranks as the
+   * smallest blocks may be on any rank */
+  int halo_too_wide = 0;
+  for (int d = 0; d < ndims; d++) {
+    halo_too_wide = halo_too_wide || (h > local[d]);
+  }
+  MPI_Allreduce(MPI_IN_PLACE, &halo_too_wide, 1, MPI_INT, MPI_LOR, cart);
+  if (halo_too_wide) {
+    if (rank == 0) {
+      fprintf(stderr, "halo width %d exceeds local grid of a process\n", h);
+    }
+    MPI_Comm_free(&cart);
+    MPI_Finalize();
+    return 1;
+  }
+  stride[ndims - 1] = 1;
+  for (int d = ndims - 2; d >= 0; d--) {
+    stride[d] = stride[d + 1] * full[d + 1];
+  }
+
+  double *u = calloc(npoints, sizeof(double));
+  double *unew = calloc(npoints, sizeof(double));
+  for (long i = 0; i < npoints; i++) {
+    u[i] = unew[i] = rank;
+  }
+
+  /* subarray types for the halo faces: send[d][0] lower inner face,
+   * send[d][1] upper inner face, recv[d][0] lower halo, recv[d][1] upper halo.
+   * Faces span the full extent of already exchanged dimensions to fill
+   * corners. */
+  MPI_Datatype send_type[MAX_NDIMS][2], recv_type[MAX_NDIMS][2];
+  int neighbour[MAX_NDIMS][2];
+  long face_bytes[MAX_NDIMS];
+  for (int d = 0; d < ndims; d++) {
+    int subsizes[MAX_NDIMS], starts[MAX_NDIMS];
+    long face_points = 1;
+    for (int k = 0; k < ndims; k++) {
+      subsizes[k] = (k < d) ? full[k] : local[k];
+      starts[k] = (k < d) ? 0 : h;
+      if (k == d) {
+        subsizes[k] = h;
+      }
+      face_points *= subsizes[k];
+    }
+    face_bytes[d] = face_points * (long)sizeof(double);
+    int offsets[4] = {h, local[d], 0, local[d] + h};
+    MPI_Datatype *types[4] = {&send_type[d][0], &send_type[d][1],
+                              &recv_type[d][0], &recv_type[d][1]};
+    for (int t = 0; t < 4; t++) {
+      starts[d] = offsets[t];
+      MPI_Type_create_subarray(ndims, full, subsizes, starts, MPI_ORDER_C,
+                               MPI_DOUBLE, types[t]);
+      MPI_Type_commit(types[t]);
+    }
+    MPI_Cart_shift(cart, d, 1, &neighbour[d][0], &neighbour[d][1]);
+  }
+
+  long bytes_per_step = 0;
+  for (int d = 0; d < ndims; d++) {
+    for (int s = 0; s < 2; s++) {
+      if (neighbour[d][s] != MPI_PROC_NULL) {
+        bytes_per_step += face_bytes[d];
+      }
+    }
+  }
+
+  /* interior bounds for the stencil loops, unused dimensions collapse to a
+   * single iteration */
+  int lo[MAX_NDIMS] = {0, 0, 0}, hi[MAX_NDIMS] = {1, 1, 1};
+  long st[MAX_NDIMS] = {0, 0, 0};
+  for (int d = 0; d < ndims; d++) {
+    lo[MAX_NDIMS - ndims + d] = h;
+    hi[MAX_NDIMS - ndims + d] = h + local[d];
+    st[MAX_NDIMS - ndims + d] = stride[d];
+  }
+  const double factor = 1. / (2 * ndims + 1);
+
+  MPI_Barrier(cart);
+  double halo_time = 0.0;
+  double t_start = MPI_Wtime();
+  for (int it = 0; it < opts.iterations; it++) {
+    double t_halo = MPI_Wtime();
+    for (int d = 0; d < ndims; d++) {
+      MPI_Sendrecv(u, 1, send_type[d][1], neighbour[d][1], d, u, 1,
+                   recv_type[d][0], neighbour[d][0], d, cart,
+                   MPI_STATUS_IGNORE);
+      MPI_Sendrecv(u, 1, send_type[d][0], neighbour[d][0], d, u, 1,
+                   recv_type[d][1], neighbour[d][1], d, cart,
+                   MPI_STATUS_IGNORE);
+    }
+    halo_time += MPI_Wtime() - t_halo;
+
+    for (int i = lo[0]; i < hi[0]; i++) {
+      for (int j = lo[1]; j < hi[1]; j++) {
+        for (int k = lo[2]; k < hi[2]; k++) {
+          long idx = i * st[0] + j * st[1] + k * st[2];
+          double sum = u[idx];
+          for (int d = MAX_NDIMS - ndims; d < MAX_NDIMS; d++) {
+            sum += u[idx - st[d]] + u[idx + st[d]];
+          }
+          unew[idx] = factor * sum;
+        }
+      }
+    }
+    double *tmp = u;
+    u = unew;
+    unew = tmp;
+  }
+  double step_time = MPI_Wtime() - t_start;
+
+  /* one CSV line per rank, written by rank 0 in rank order */
+  char line[512];
+  int len = snprintf(line, sizeof(line), "%s,%d,%d,", method_names[opts.method],
+                     size, ndims);
+  for (int d = 0; d < ndims; d++) {
+    len += snprintf(line + len, sizeof(line) - len, "%d%s", opts.global[d],
+                    d < ndims - 1 ? "x" : ",");
+  }
+  for (int d = 0; d < ndims; d++) {
+    len += snprintf(line + len, sizeof(line) - len, "%d%s", dims[d],
+                    d < ndims - 1 ? "x" : ",");
+  }
+  for (int d = 0; d < ndims; d++) {
+    len += snprintf(line + len, sizeof(line) - len, "%d%s", local[d],
+                    d < ndims - 1 ? "x" : ",");
+  }
+  snprintf(line + len, sizeof(line) - len, "%d,%d,%ld,%g,%g\n", rank,
+           opts.iterations, bytes_per_step, halo_time / opts.iterations,
+           step_time / opts.iterations);
+
+  char *lines = NULL;
+  if (rank == 0) {
+    lines = malloc((size_t)size * sizeof(line));
+  }
+  MPI_Gather(line, sizeof(line), MPI_CHAR, lines, sizeof(line), MPI_CHAR, 0,
+             cart);
+  if (rank == 0) {
+    FILE *out = stdout;
+    if (opts.output != NULL) {
+      out = fopen(opts.output, "a");
+      if (out == NULL) {
+        fprintf(stderr, "cannot open %s\n", opts.output);
+        MPI_Abort(MPI_COMM_WORLD, 1);
+      }
+    }
+    if (opts.header) {
+      fprintf(out, "method,nprocs,ndims,global,dims,local,rank,iterations,"
+                   "bytes_per_step,halo_time_per_step,step_time_per_step\n");
+    }
+    for (int r = 0; r < size; r++) {
+      fputs(&lines[r * sizeof(line)], out);
+    }
+    if (out != stdout) {
+      fclose(out);
+    }
+    free(lines);
+  }
+
+  for (int d = 0; d < ndims; d++) {
+    for (int s = 0; s < 2; s++) {
+      MPI_Type_free(&send_type[d][s]);
+      MPI_Type_free(&recv_type[d][s]);
+    }
+  }
+  free(u);
+  free(unew);
+  MPI_Comm_free(&cart);
+  MPI_Finalize();
+  return 0;
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026      High Performance Computing Center Stuttgart,
+ *                         University of Stuttgart.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER NOR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** Benchmark of MPI_Info_snapshot / MPI_Info_restore
+ *
+ * Copies an info object with nkeys (key,value) pairs into a new info object
+ * key by key (MPI_Info_get_nthkey, MPI_Info_get_valuelen, MPI_Info_get,
+ * MPI_Info_set), via MPI_Info_snapshot and MPI_Info_restore, via
+ * MPI_Info_get_json and MPI_Info_set_json and with MPI_Info_dup as reference.
+ * Reports the average time per copy as CSV.
+ *
+ * Usage:
+ *   info_snapshot_bench [nkeys] [repetitions]    (defaults 1000 100)
+ */
+
+#include "MPI_Info_get_json.h"
+#include "MPI_Info_set_json.h"
+#include "MPI_Info_snapshot.h"
+
+#include <mpi.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static void copy_key_by_key(MPI_Info info, MPI_Info copy) {
+  int nkeys;
+  char key[MPI_MAX_INFO_KEY + 1];
+  char value[MPI_MAX_INFO_VAL + 1];
+  MPI_Info_get_nkeys(info, &nkeys);
+  for (int i = 0; i < nkeys; i++) {
+    int valuelen, flag;
+    MPI_Info_get_nthkey(info, i, key);
+    MPI_Info_get_valuelen(info, key, &valuelen, &flag);
+    MPI_Info_get(info, key, valuelen, value, &flag);
+    MPI_Info_set(copy, key, value);
+  }
+}
+
+static void copy_snapshot(MPI_Info info, MPI_Info copy) {
+  void *buf;
+  int size;
+  MPI_Info_snapshot(info, &size, &buf);
+  MPI_Info_restore(buf, size, copy);
+  free(buf);
+}
+
+static void copy_json(MPI_Info info, MPI_Info copy) {
+  int buflen = 0;
+  MPI_Info_get_json(info, &buflen, NULL);
+  char *json_str = malloc(buflen);
+  MPI_Info_get_json(info, &buflen, json_str);
+  MPI_Info_set_json(copy, json_str);
+  free(json_str);
+}
+
+static void copy_dup(MPI_Info info, MPI_Info copy) {
+  MPI_Info dup;
+  MPI_Info_dup(info, &dup);
+  MPI_Info_free(&dup);
+  (void)copy;
+}
+
+static double time_copy(void (*copy_fn)(MPI_Info, MPI_Info), MPI_Info info,
+                        int repetitions) {
+  double time = 0.0;
+  for (int r = 0; r < repetitions; r++) {
+    MPI_Info copy;
+    MPI_Info_create(&copy);
+    double t = MPI_Wtime();
+    copy_fn(info, copy);
+    time += MPI_Wtime() - t;
+    MPI_Info_free(&copy);
+  }
+  return time / repetitions;
+}
+
+int main(int argc, char *argv[]) {
+  MPI_Init(&argc, &argv);
+
+  int nkeys = (argc > 1) ? atoi(argv[1]) : 1000;
+  int repetitions = (argc > 2) ? atoi(argv[2]) : 100;
+  if (nkeys < 0 || repetitions < 1) {
+    fprintf(stderr, "usage: %s [nkeys] [repetitions]\n", argv[0]);
+    MPI_Finalize();
+    return 1;
+  }
+
+  MPI_Info info;
+  MPI_Info_create(&info);
+  for (int i = 0; i < nkeys; i++) {
+    char key[32], value[64];
+    snprintf(key, sizeof(key), "hint_%d", i);
+    snprintf(value, sizeof(value), "value_of_hint_%d", i);
+    MPI_Info_set(info, key, value);
+  }
+
+  printf("method,nkeys,time_per_copy\n");
+  printf("key_by_key,%d,%g\n", nkeys,
+         time_copy(copy_key_by_key, info, repetitions));
+  printf("snapshot_restore,%d,%g\n", nkeys,
+         time_copy(copy_snapshot, info, repetitions));
+  printf("get_json_set_json,%d,%g\n", nkeys,
+         time_copy(copy_json, info, repetitions));
+  printf("info_dup,%d,%g\n", nkeys, time_copy(copy_dup, info, repetitions));
+
+  MPI_Info_free(&info);
+  MPI_Finalize();
+  return 0;
+}
@@ -0,0 +1,151 @@
+/* Performance fuzz target for MPI_Dims_weighted_create
+ *
+ * In contrast to fuzz_MPI_Dims_weighted_create.c this target looks for inputs
+ * that make the optdims() search slow. For every input the number of visited
+ * search nodes and the wall time are measured and the input is reported as a
+ * failure (abort) if one of the budgets is exceeded, so that libFuzzer stores
+ * it as a reproducer.
+ *
+ * Budgets and limits are configurable via environment variables:
+ *   DIMS_PERF_MAX_NODES  maximum number of search nodes (default 20000000)
+ *   DIMS_PERF_MAX_USEC   maximum wall time in microseconds (default 5000000)
+ *   DIMS_PERF_MAX_NDIMS  maximum accepted ndims (default 64)
+ *   DIMS_PERF_LOG        file to append per-input statistics to as CSV lines
+ *                        nnodes,ndims,nodes,usec
+ *
+ * Compiled with DIMS_PERF_REPLAY_MAIN the target gets a main() that replays
+ * the input files given on the command line, e.g. the checked in corpus in
+ * fuzz/corpus/dims_perf, without requiring libFuzzer. The replay fails for
+ * files that the target would reject or that exceed its input buffer.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static unsigned long long optdims_nodes = 0;
+static long long optdims_usec = 0;
+#define OPTDIMS_NODE_HOOK() (optdims_nodes++)
+
+/* include implementation directly to get access to the search node hook */
+#include "../src/MPI_Dims_weighted_create.c"
+
+static long long env_budget(const char *name, long long default_value) {
+  const char *value = getenv(name);
+  if (value == NULL || value[0] == '\0') {
+    return default_value;
+  }
+  return atoll(value);
+}
+
+/** Check the input layout and read nnodes and ndims
+ *
+ * Data layout as in fuzz_MPI_Dims_weighted_create.c:
+ *   nnodes(int),
+ *   ndims(int),
+ *   dim_weights(double[ndims]),
+ *   dims(int[ndims])
+ *
+ * @return 1 if the input is accepted, otherwise 0
+ */
+static int parse_input(const uint8_t *Data, size_t Size, int *nnodes,
+                       int *ndims) {
+  /* we need at least nnodes and ndims */
+  if (Size < 2 * sizeof(int)) {
+    return 0;
+  }
+  memcpy(nnodes, &Data[0], sizeof(int));
+  memcpy(ndims, &Data[sizeof(int)], sizeof(int));
+
+  /* the solver keeps its work arrays on the stack, so only reject unbounded
+   * dimensions here */
+  if (*ndims < 0 || *ndims > env_budget("DIMS_PERF_MAX_NDIMS", 64)) {
+    return 0;
+  }
+  /* check if we have correct amount of input data */
+  if (Size != (2 + *ndims) * sizeof(int) + *ndims * sizeof(double)) {
+    return 0;
+  }
+  return 1;
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *Data, size_t Size) {
+  int nnodes;
+  int ndims;
+  if (!parse_input(Data, Size, &nnodes, &ndims)) {
+    return 0;
+  }
+  double *dim_weights = calloc(1, ndims * sizeof(double) + 1);
+  memcpy(dim_weights, &Data[2 * sizeof(int)], ndims * sizeof(double));
+
+  int *dims = calloc(1, ndims * sizeof(int) + 1);
+  memcpy(dims, &Data[2 * sizeof(int) + ndims * sizeof(double)],
+         ndims * sizeof(int));
+
+  struct timespec start, end;
+  optdims_nodes = 0;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  MPI_Dims_weighted_create(nnodes, ndims, dim_weights, dims);
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  long long usec = (end.tv_sec - start.tv_sec) * 1000000LL +
+                   (end.tv_nsec - start.tv_nsec) / 1000;
+  optdims_usec = usec;
+
+  free(dims);
+  free(dim_weights);
+
+  const char *log_name = getenv("DIMS_PERF_LOG");
+  if (log_name != NULL && log_name[0] != '\0') {
+    FILE *log = fopen(log_name, "a");
+    if (log != NULL) {
+      fprintf(log, "%d,%d,%llu,%lld\n", nnodes, ndims, optdims_nodes, usec);
+      fclose(log);
+    }
+  }
+
+  long long max_nodes = env_budget("DIMS_PERF_MAX_NODES", 20000000);
+  long long max_usec = env_budget("DIMS_PERF_MAX_USEC", 5000000);
+  if ((long long)optdims_nodes > max_nodes || usec > max_usec) {
+    fprintf(stderr,
+            "budget exceeded: nnodes=%d ndims=%d nodes=%llu (max %lld) "
+            "usec=%lld (max %lld)\n",
+            nnodes, ndims, optdims_nodes, max_nodes, usec, max_usec);
+    abort();
+  }
+  return 0; // Non-zero return values are reserved for future use.
+}
+
+#ifdef DIMS_PERF_REPLAY_MAIN
+int main(int argc, char *argv[]) {
+  for (int i = 1; i < argc; i++) {
+    FILE *f = fopen(argv[i], "rb");
+    if (f == NULL) {
+      fprintf(stderr, "cannot open %s\n", argv[i]);
+      return 1;
+    }
+    uint8_t data[4096];
+    size_t size = fread(data, 1, sizeof(data), f);
+    int truncated = (size == sizeof(data) && fgetc(f) != EOF);
+    fclose(f);
+    /* a rejected input would silently pass without running the solver */
+    int nnodes;
+    int ndims;
+    if (truncated || !parse_input(data, size, &nnodes, &ndims)) {
+      fprintf(stderr, "%s: input %s\n", argv[i],
+              truncated ? "larger than replay buffer" : "rejected");
+      return 1;
+    }
+    optdims_nodes = 0;
+    optdims_usec = 0;
+    LLVMFuzzerTestOneInput(data, size);
+    printf("%s: nodes=%llu usec=%lld\n", argv[i], optdims_nodes,
+           optdims_usec);
+  }
+  return 0;
+}
+#endif
@@ -0,0 +1,417 @@
+/*
+ * Copyright (c) 2026      High Performance Computing Center Stuttgart,
+ *                         University of Stuttgart.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER NOR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "MPI_Cart_topo_weighted_create.h"
+
+#include "MPI_Dims_weighted_create.h"
+#include "dims_candidates.h"
+
+#include <json-c/json.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** maximum number of torus dimensions in a machine description */
+#define MAX_TORUS_DIMS 8
+/** number of best process grids (by weighted sum) considered for embedding */
+#define MAX_DIMS_CANDIDATES 8
+/** maximum number of node tilings considered per process grid */
+#define MAX_TILE_CANDIDATES 1024
+/** up to this number of dimensions all tile orders are tried */
+#define MAX_PERMUTED_DIMS 4
+
+enum machine_type { MACHINE_TORUS, MACHINE_DRAGONFLY };
+
+struct machine {
+  enum machine_type type;
+  int torus_ndims;
+  int extents[MAX_TORUS_DIMS];
+  int groups;
+  int routers_per_group;
+  int nodes_per_router;
+  int ranks_per_node;
+  long nodes;
+};
+
+/** read positive integer member key of obj, keep value if key not present */
+static int json_get_positive_int(struct json_object *obj, const char *key,
+                                 int *value) {
+  struct json_object *member;
+  if (!json_object_object_get_ex(obj, key, &member)) {
+    return MPI_SUCCESS;
+  }
+  *value = json_object_get_int(member);
+  return (*value > 0) ? MPI_SUCCESS : MPI_ERR_ARG;
+}
+
+/** load machine description from JSON file */
+static int machine_load(const char *topo_file, struct machine *machine) {
+  struct json_object *jobj = json_object_from_file(topo_file);
+  if (jobj == NULL) {
+    return MPI_ERR_FILE;
+  }
+
+  int ret = MPI_ERR_ARG;
+  struct json_object *member;
+  memset(machine, 0, sizeof(*machine));
+  machine->ranks_per_node = 1;
+  if (!json_object_object_get_ex(jobj, "type", &member) ||
+      !json_object_is_type(member, json_type_string)) {
+    goto out;
+  }
+  const char *type = json_object_get_string(member);
+  if (strcmp(type, "torus") == 0) {
+    machine->type = MACHINE_TORUS;
+    if (!json_object_object_get_ex(jobj, "extents", &member) ||
+        !json_object_is_type(member, json_type_array)) {
+      goto out;
+    }
+    machine->torus_ndims = json_object_array_length(member);
+    if (machine->torus_ndims < 1 || machine->torus_ndims > MAX_TORUS_DIMS) {
+      goto out;
+    }
+    machine->nodes = 1;
+    for (int i = 0; i < machine->torus_ndims; i++) {
+      machine->extents[i] =
+          json_object_get_int(json_object_array_get_idx(member, i));
+      if (machine->extents[i] < 1) {
+        goto out;
+      }
+      machine->nodes *= machine->extents[i];
+    }
+  } else if (strcmp(type, "dragonfly") == 0) {
+    machine->type = MACHINE_DRAGONFLY;
+    machine->groups = 0;
+    machine->routers_per_group = 0;
+    machine->nodes_per_router = 1;
+    if (json_get_positive_int(jobj, "groups", &machine->groups) ||
+        json_get_positive_int(jobj, "routers_per_group",
+                              &machine->routers_per_group) ||
+        json_get_positive_int(jobj, "nodes_per_router",
+                              &machine->nodes_per_router) ||
+        machine->groups < 1 || machine->routers_per_group < 1) {
+      goto out;
+    }
+    machine->nodes = (long)machine->groups * machine->routers_per_group *
+                     machine->nodes_per_router;
+  } else {
+    goto out;
+  }
+  if (json_get_positive_int(jobj, "ranks_per_node", &machine->ranks_per_node)) {
+    goto out;
+  }
+  ret = MPI_SUCCESS;
+
+out:
+  json_object_put(jobj);
+  return ret;
+}
+
+/** number of network hops between two nodes of the machine */
+static int machine_hops(const struct machine *machine, int a, int b) {
+  if (a == b) {
+    return 0;
+  }
+  int hops = 0;
+  if (machine->type == MACHINE_TORUS) {
+    for (int i = machine->torus_ndims - 1; i >= 0; i--) {
+      int extent = machine->extents[i];
+      int d = abs(a % extent - b % extent);
+      hops += (d < extent - d) ? d : extent - d;
+      a /= extent;
+      b /= extent;
+    }
+  } else {
+    int router_a = a / machine->nodes_per_router;
+    int router_b = b / machine->nodes_per_router;
+    if (router_a == router_b) {
+      hops = 2;
+    } else if (router_a / machine->routers_per_group ==
+               router_b / machine->routers_per_group) {
+      hops = 3;
+    } else {
+      hops = 5;
+    }
+  }
+  return hops;
+}
+
+/** row-major linear index of grid coordinates as used by MPI_Cart_create */
+static int grid_index(int ndims, const int *dims, const int *coords) {
+  int index = 0;
+  for (int i = 0; i < ndims; i++) {
+    index = index * dims[i] + coords[i];
+  }
+  return index;
+}
+
+/** next permutation in lexicographic order, returns 0 after the last one */
+static int next_permutation(int n, int *perm) {
+  int i = n - 2;
+  while (i >= 0 && perm[i] > perm[i + 1]) {
+    i--;
+  }
+  if (i < 0) {
+    return 0;
+  }
+  int j = n - 1;
+  while (perm[j] < perm[i]) {
+    j--;
+  }
+  int tmp = perm[i];
+  perm[i] = perm[j];
+  perm[j] = tmp;
+  for (int l = i + 1, r = n - 1; l < r; l++, r--) {
+    tmp = perm[l];
+    perm[l] = perm[r];
+    perm[r] = tmp;
+  }
+  return 1;
+}
+
+/** Embed ranks into the grid
+ *
+ * Consecutive ranks fill tiles of extents tile (row-major within a tile),
+ * tiles are laid out row-major over the tile grid with the dimension order
+ * given by perm, perm[ndims - 1] running fastest.
+ */
+static void embed(int nnodes, int ndims, const int *dims, const int *tile,
+                  const int *perm, int *coords) {
+  int tile_size = 1;
+  int tiles[ndims];
+  for (int i = 0; i < ndims; i++) {
+    tile_size *= tile[i];
+    tiles[i] = dims[i] / tile[i];
+  }
+  for (int r = 0; r < nnodes; r++) {
+    int t = r / tile_size;
+    int l = r % tile_size;
+    int *c = &coords[r * ndims];
+    for (int k = ndims - 1; k >= 0; k--) {
+      int i = perm[k];
+      c[i] = (t % tiles[i]) * tile[i];
+      t /= tiles[i];
+    }
+    for (int i = ndims - 1; i >= 0; i--) {
+      c[i] += l % tile[i];
+      l /= tile[i];
+    }
+  }
+}
+
+/** hop-weighted halo volume of an embedding */
+static double embedding_cost(const struct machine *machine, int nnodes,
+                             int ndims, const double *dim_weights,
+                             const int *periods, const int *dims,
+                             const int *coords, int *rank_of) {
+  for (int r = 0; r < nnodes; r++) {
+    rank_of[grid_index(ndims, dims, &coords[r * ndims])] = r;
+  }
+  double cost = 0.0;
+  int neighbour[ndims];
+  for (int r = 0; r < nnodes; r++) {
+    int node = r / machine->ranks_per_node;
+    for (int i = 0; i < ndims; i++) {
+      if (dims[i] == 1) {
+        continue;
+      }
+      memcpy(neighbour, &coords[r * ndims], ndims * sizeof(int));
+      if (++neighbour[i] == dims[i]) {
+        if (periods == NULL || !periods[i]) {
+          continue;
+        }
+        neighbour[i] = 0;
+      }
+      int n = rank_of[grid_index(ndims, dims, neighbour)];
+      double weight = (dim_weights == MPI_EQUAL_WEIGHTS) ? 1.0 : dim_weights[i];
+      cost += machine_hops(machine, node, n / machine->ranks_per_node) *
+              weight * dims[i];
+    }
+  }
+  return cost;
+}
+
+int MPI_Dims_topo_weighted_create(int nnodes, int ndims,
+                                  const double *dim_weights, const int *periods,
+                                  const char *topo_file, int *dims,
+                                  int *coords) {
+  int ret = PMPI_Dims_topo_weighted_create(nnodes, ndims, dim_weights, periods,
+                                           topo_file, dims, coords);
+  return ret;
+}
+
+int PMPI_Dims_topo_weighted_create(int nnodes, int ndims,
+                                   const double *dim_weights,
+                                   const int *periods, const char *topo_file,
+                                   int *dims, int *coords) {
+  if (nnodes < 1) {
+    return MPI_ERR_ARG;
+  }
+  if (ndims < 1) {
+    return MPI_ERR_DIMS;
+  }
+
+  struct machine machine;
+  int ret = machine_load(topo_file, &machine);
+  if (ret != MPI_SUCCESS) {
+    return ret;
+  }
+  if (nnodes > machine.nodes * machine.ranks_per_node) {
+    return MPI_ERR_ARG;
+  }
+
+  int candidates[MAX_DIMS_CANDIDATES * ndims];
+  int ncandidates = dims_candidates(nnodes, ndims, dim_weights,
+                                    MAX_DIMS_CANDIDATES, candidates, NULL);
+  if (ncandidates == 0) {
+    /* there is at least one factorization, so the search ran out of memory */
+    return MPI_ERR_NO_MEM;
+  }
+
+  int *tiles = malloc((MAX_TILE_CANDIDATES + 1) * ndims * sizeof(int));
+  int *tmp_coords = malloc((size_t)nnodes * ndims * sizeof(int));
+  int *rank_of = malloc((size_t)nnodes * sizeof(int));
+  if (tiles == NULL || tmp_coords == NULL || rank_of == NULL) {
+    free(rank_of);
+    free(tmp_coords);
+    free(tiles);
+    return MPI_ERR_NO_MEM;
+  }
+
+  /* tilings of the ranks of a node, all-ones tile is always a candidate */
+  int ntiles = 0;
+  if (machine.ranks_per_node > 1) {
+    ntiles = dims_candidates(machine.ranks_per_node, ndims, MPI_EQUAL_WEIGHTS,
+                             MAX_TILE_CANDIDATES, tiles, NULL);
+  }
+  for (int i = 0; i < ndims; i++) {
+    tiles[ntiles * ndims + i] = 1;
+  }
+  ntiles++;
+
+  double min_cost = -1.0;
+  int perm[ndims];
+  for (int c = 0; c < ncandidates; c++) {
+    const int *cand = &candidates[c * ndims];
+    for (int t = 0; t < ntiles; t++) {
+      const int *tile = &tiles[t * ndims];
+      int fits = 1;
+      for (int i = 0; i < ndims; i++) {
+        fits = fits && (cand[i] % tile[i] == 0);
+      }
+      if (!fits) {
+        continue;
+      }
+      for (int i = 0; i < ndims; i++) {
+        perm[i] = i;
+      }
+      do {
+        embed(nnodes, ndims, cand, tile, perm, tmp_coords);
+        double cost = embedding_cost(&machine, nnodes, ndims, dim_weights,
+                                     periods, cand, tmp_coords, rank_of);
+        if (min_cost < 0.0 || cost < min_cost) {
+          min_cost = cost;
+          memcpy(dims, cand, ndims * sizeof(int));
+          memcpy(coords, tmp_coords, (size_t)nnodes * ndims * sizeof(int));
+        }
+      } while (ndims <= MAX_PERMUTED_DIMS && next_permutation(ndims, perm));
+    }
+  }
+
+  free(rank_of);
+  free(tmp_coords);
+  free(tiles);
+  return MPI_SUCCESS;
+}
+
+int MPI_Cart_topo_weighted_create(MPI_Comm comm_old, int ndims,
+                                  const double *dim_weights, const int *periods,
+                                  const char *topo_file, MPI_Comm *comm_cart) {
+  int ret = PMPI_Cart_topo_weighted_create(comm_old, ndims, dim_weights,
+                                           periods, topo_file, comm_cart);
+  return ret;
+}
+
+int PMPI_Cart_topo_weighted_create(MPI_Comm comm_old, int ndims,
+                                   const double *dim_weights,
+                                   const int *periods, const char *topo_file,
+                                   MPI_Comm *comm_cart) {
+  int size, rank;
+  MPI_Comm_size(comm_old, &size);
+  MPI_Comm_rank(comm_old, &rank);
+
+  if (ndims < 1) {
+    return MPI_ERR_DIMS;
+  }
+
+  /* the search runs on rank 0 only, so all ranks fail or succeed together */
+  int dims[ndims];
+  int *keys = NULL;
+  int ret = MPI_SUCCESS;
+  if (rank == 0) {
+    int *coords = malloc((size_t)size * ndims * sizeof(int));
+    keys = malloc((size_t)size * sizeof(int));
+    if (coords == NULL || keys == NULL) {
+      ret = MPI_ERR_NO_MEM;
+    } else {
+      ret = PMPI_Dims_topo_weighted_create(size, ndims, dim_weights, periods,
+                                           topo_file, dims, coords);
+    }
+    /* order ranks by their grid position, so that MPI_Cart_create without
+     * reordering assigns the computed coordinates */
+    for (int r = 0; r < size && ret == MPI_SUCCESS; r++) {
+      keys[r] = grid_index(ndims, dims, &coords[r * ndims]);
+    }
+    free(coords);
+  }
+  MPI_Bcast(&ret, 1, MPI_INT, 0, comm_old);
+  if (ret != MPI_SUCCESS) {
+    free(keys);
+    return ret;
+  }
+  MPI_Bcast(dims, ndims, MPI_INT, 0, comm_old);
+  int key;
+  ret = MPI_Scatter(keys, 1, MPI_INT, &key, 1, MPI_INT, 0, comm_old);
+  free(keys);
+  if (ret != MPI_SUCCESS) {
+    return ret;
+  }
+
+  int cart_periods[ndims];
+  for (int i = 0; i < ndims; i++) {
+    cart_periods[i] = (periods != NULL) ? periods[i] : 0;
+  }
+
+  MPI_Comm comm_ordered;
+  ret = MPI_Comm_split(comm_old, 0, key, &comm_ordered);
+  if (ret != MPI_SUCCESS) {
+    return ret;
+  }
+  ret = MPI_Cart_create(comm_ordered, ndims, dims, cart_periods, 0, comm_cart);
+  MPI_Comm_free(&comm_ordered);
+  return ret;
+}
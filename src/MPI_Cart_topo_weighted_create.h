@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026      High Performance Computing Center Stuttgart,
+ *                         University of Stuttgart.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER NOR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SRC_MPI_CART_TOPO_WEIGHTED_CREATE_H_
+#define SRC_MPI_CART_TOPO_WEIGHTED_CREATE_H_
+
+#include <mpi.h>
+
+#if __cplusplus
+extern "C" {
+#endif
+
+/** Compute dims and a rank embedding for a machine topology
+ *
+ * Extends MPI_Dims_weighted_create by a description of the network of the
+ * machine. Among the process grids with the best weighted sum
+ * \f$\sum_i \omega_i dims_i\f$ it selects the dims and the embedding of ranks
+ * into the grid that minimize the hop-weighted halo volume
+ * \f[
+ *   \sum_{r} \sum_{i=1}^{\text{ndims}} \text{hops}(r, r + e_i)\,
+ *   \omega_i\, dims_i ,
+ * \f]
+ * where \f$\omega_i dims_i\f$ is proportional to the halo size in dimension i
+ * for weights \f$\omega_i = \frac{1}{g_i}\f$. Embeddings considered are tiles
+ * of the ranks of one node within the grid and all orders in which tiles are
+ * laid out along the node numbering of the machine, which folds grid axes onto
+ * torus axes.
+ *
+ * The machine is described by a JSON file, ranks are assumed to be placed
+ * block-wise, i.e. rank r runs on node r / ranks_per_node:
+ *
+ *   {"type": "torus", "extents": [8, 8, 4], "ranks_per_node": 4}
+ *
+ * Torus nodes are numbered row-major, hops are the torus distance.
+ *
+ *   {"type": "dragonfly", "groups": 16, "routers_per_group": 8,
+ *    "nodes_per_router": 4, "ranks_per_node": 4}
+ *
+ * Dragonfly nodes are numbered by group, router, node. Hops count the links
+ * of a minimal route: 2 via the same router, 3 within a group and 5 between
+ * groups.
+ *
+ * @param[in] nnodes number of processes
+ * @param[in] ndims number of dimensions
+ * @param[in] dim_weights weight factors for dimensions or MPI_EQUAL_WEIGHTS
+ * @param[in] periods periodicity of the grid in each dimension or NULL
+ * @param[in] topo_file path of the JSON machine description
+ * @param[out] dims computed values for dimensions
+ * @param[out] coords grid coordinates of each rank, nnodes * ndims entries,
+ *                    coordinates of rank r start at coords[r * ndims]
+ */
+int MPI_Dims_topo_weighted_create(int nnodes, int ndims,
+                                  const double *dim_weights, const int *periods,
+                                  const char *topo_file, int *dims,
+                                  int *coords);
+
+/** PMPI interface corresponding to MPI call */
+int PMPI_Dims_topo_weighted_create(int nnodes, int ndims,
+                                   const double *dim_weights,
+                                   const int *periods, const char *topo_file,
+                                   int *dims, int *coords);
+
+/** Create a Cartesian communicator mapped onto a machine topology
+ *
+ * Collective over comm_old. Rank 0 reads the machine description and
+ * computes dims and rank embedding with MPI_Dims_topo_weighted_create, the
+ * result is broadcast. Returns a Cartesian communicator in which the rank with
+ * old rank r has the computed coordinates of r.
+ *
+ * @param[in] comm_old input communicator
+ * @param[in] ndims number of dimensions
+ * @param[in] dim_weights weight factors for dimensions or MPI_EQUAL_WEIGHTS
+ * @param[in] periods periodicity of the grid in each dimension or NULL
+ * @param[in] topo_file path of the JSON machine description
+ * @param[out] comm_cart communicator with Cartesian topology
+ */
+int MPI_Cart_topo_weighted_create(MPI_Comm comm_old, int ndims,
+                                  const double *dim_weights, const int *periods,
+                                  const char *topo_file, MPI_Comm *comm_cart);
+
+/** PMPI interface corresponding to MPI call */
+int PMPI_Cart_topo_weighted_create(MPI_Comm comm_old, int ndims,
+                                   const double *dim_weights,
+                                   const int *periods, const char *topo_file,
+                                   MPI_Comm *comm_cart);
+
+#if __cplusplus
+}
+#endif
+
+#endif // SRC_MPI_CART_TOPO_WEIGHTED_CREATE_H_
@@ -27,6 +27,7 @@
  */
 
 #include "MPI_Dims_weighted_create.h"
+#include "dims_candidates.h"
 
 #include <limits.h>
 #include <math.h>
@@ -35,44 +36,35 @@
 #include <stdio.h>
 #include <stdlib.h>
 
-/** maximum number of divisors for int32 (int max~10e9) according to
- * http://oeis.org/A066150 is 1344 */
-#define MAX_DIVISORS_FOR_INT32 1344
+/** hook invoked for every node visited by the optdims() search, e.g. to count
+ * search nodes in the performance fuzz target; expands to nothing by default */
+#ifndef OPTDIMS_NODE_HOOK
+#define OPTDIMS_NODE_HOOK()
+#endif
 
-/** Return list of divisors
+/** Compute all primes up to n with a sieve of Eratosthenes
  *
- * @param[in] p number for which divisors shall be computed
- * @param[out] divisors list of divisors in descending order, passed array must
- *                      provide enought space for all divisors
- * @return number of divisors if succesful, otherwise 0
+ * @param[in] n largest number
+ * @param[out] primes array of at least n / 2 + 1 entries
+ * @return number of primes
  */
-static int calc_divisors(int n, int *divisors) {
-  int i = 0;
-  /* compute divisors up to sqrt(n) and store them in ascending order */
-  divisors[i++] = 1;
-  if (n % 2 == 0) {
-    divisors[i++] = 2;
-    for (int f = 3; f <= floor(sqrt(n)); f++) {
-      if (n % f == 0) {
-        divisors[i++] = f;
-      }
+static int calc_primes(int n, int *primes) {
+  char *composite = calloc((size_t)n + 1, 1);
+  if (composite == NULL) {
+    return -1;
+  }
+  int count = 0;
+  for (int p = 2; p <= n; p++) {
+    if (composite[p]) {
+      continue;
     }
-
-  } else {
-    for (int f = 3; f <= floor(sqrt(n)); f += 2) {
-      if (n % f == 0) {
-        divisors[i++] = f;
-      }
+    primes[count++] = p;
+    for (long k = (long)p * p; k <= n; k += p) {
+      composite[k] = 1;
     }
   }
-
-  /* compute remaining divisors from known divisors <= sqrt(n)
-   * and reorder list in desceding order. */
-  for (int j = i - 1; j >= 0; j--, i++) {
-    divisors[i] = divisors[j];
-    divisors[j] = n / divisors[i];
-  }
-  return i;
+  free(composite);
+  return count;
 }
 
 /** recursive factorization optimization looping over (remaining) divisors for
@@ -88,6 +80,7 @@ static int calc_divisors(int n, int *divisors) {
 static void optdims(const int p, int *divisors, const int ndims, int i,
                     double *dim_weights, int *dims, double *min_sum,
                     int *min_dims, int *min_diff) {
+  OPTDIMS_NODE_HOOK();
   if (p == 1) {
     for (int k = i; k < ndims; k++) {
       dims[k] = 1;
@@ -142,6 +135,30 @@ static void optdims(const int p, int *divisors, const int ndims, int i,
   }
 }
 
+/** Run the optdims search for nnodes > 1 on a precomputed divisor list
+ *
+ * @param[in] nnodes number to factorize
+ * @param[in] divisors divisors of nnodes in descending order, ending with 1
+ * @param[in] ndims number of factors
+ * @param[in] sorted_dim_weights weights in increasing order
+ * @param[in] tmp_dims scratch space of ndims entries
+ * @param[out] min_dims optimal dims in order of sorted_dim_weights
+ * @return weighted sum of the optimal dims
+ */
+static double optdims_solve(const int nnodes, int *divisors, const int ndims,
+                            double *sorted_dim_weights, int *tmp_dims,
+                            int *min_dims) {
+  double min_sum = ((double)nnodes) * ndims * sorted_dim_weights[ndims - 1];
+  int min_diff = nnodes - 1;
+  for (int i = 0; i < ndims; i++) {
+    min_dims[i] = 1;
+    tmp_dims[i] = 1;
+  }
+  optdims(nnodes, divisors, ndims, 0, sorted_dim_weights, tmp_dims, &min_sum,
+          min_dims, &min_diff);
+  return min_sum;
+}
+
 int MPI_Dims_weighted_create(const int nnodes, const int ndims,
                              const double *dim_weights, int *dims) {
   int ret = PMPI_Dims_weighted_create(nnodes, ndims, dim_weights, dims);
@@ -189,52 +206,95 @@ int PMPI_Dims_weighted_create(const int nnodes, const int ndims,
   }
 
   double tmp_dim_weights[ndims];
-  if (dim_weights == MPI_EQUAL_WEIGHTS) {
-    for (int i = 0; i < ndims; i++) {
-      tmp_dim_weights[i] = 1.0;
-    }
-  } else {
-    for (int i = 0; i < ndims; i++) {
-      tmp_dim_weights[i] = dim_weights[i];
-    }
-  }
-
   int permutation[ndims];
-  for (int i = 0; i < ndims; i++) {
-    permutation[i] = i;
-  }
-  for (int i = 0; i < ndims; i++) {
-    for (int j = i + 1; j < ndims; j++) {
-      if (tmp_dim_weights[i] > tmp_dim_weights[j]) {
-        double tmp_weight = tmp_dim_weights[i];
-        tmp_dim_weights[i] = tmp_dim_weights[j];
-        tmp_dim_weights[j] = tmp_weight;
-        int tmp_i = permutation[i];
-        permutation[i] = permutation[j];
-        permutation[j] = tmp_i;
-      }
-    }
-  }
+  dims_sort_weights(ndims, dim_weights, tmp_dim_weights, permutation);
 
-  double min_sum = ((double)nnodes) * ndims * tmp_dim_weights[ndims - 1];
-  int min_diff = nnodes - 1;
   int min_dims[ndims];
-  for (int i = 0; i < ndims; i++) {
-    min_dims[i] = 1;
-  }
   int tmp_dims[ndims];
+  int divisors[MAX_DIVISORS_FOR_INT32];
+  dims_divisors(nnodes, NULL, 0, divisors);
+  optdims_solve(nnodes, divisors, ndims, tmp_dim_weights, tmp_dims, min_dims);
+
   for (int i = 0; i < ndims; i++) {
-    tmp_dims[i] = 1;
+    dims[permutation[i]] = min_dims[i];
   }
 
-  int divisors[MAX_DIVISORS_FOR_INT32];
-  calc_divisors(nnodes, divisors);
-  optdims(nnodes, divisors, ndims, 0, tmp_dim_weights, tmp_dims, &min_sum,
-          min_dims, &min_diff);
+  return MPI_SUCCESS;
+}
+
+int MPI_Dims_weighted_create_range(const int nnodes_first,
+                                   const int nnodes_last, const int ndims,
+                                   const double *dim_weights, int *dims,
+                                   double *objectives) {
+  int ret = PMPI_Dims_weighted_create_range(nnodes_first, nnodes_last, ndims,
+                                            dim_weights, dims, objectives);
+  return ret;
+}
 
+int PMPI_Dims_weighted_create_range(const int nnodes_first,
+                                    const int nnodes_last, const int ndims,
+                                    const double *dim_weights, int *dims,
+                                    double *objectives) {
+  if (nnodes_first < 1 || nnodes_last < nnodes_first) {
+    return MPI_ERR_ARG;
+  }
+  if (ndims < 1) {
+    return MPI_ERR_DIMS;
+  }
+
+  /* primes up to sqrt(nnodes_last) suffice to factorize all numbers */
+  int prime_limit = (int)floor(sqrt(nnodes_last));
+  int *primes = malloc(((size_t)prime_limit / 2 + 1) * sizeof(int));
+  if (primes == NULL) {
+    return MPI_ERR_NO_MEM;
+  }
+  int nprimes = calc_primes(prime_limit, primes);
+  if (nprimes < 0) {
+    free(primes);
+    return MPI_ERR_NO_MEM;
+  }
+
+  double tmp_dim_weights[ndims];
+  int permutation[ndims];
+  dims_sort_weights(ndims, dim_weights, tmp_dim_weights, permutation);
+  double ones_sum = 0.0;
   for (int i = 0; i < ndims; i++) {
-    dims[permutation[i]] = min_dims[i];
+    ones_sum += tmp_dim_weights[i];
+  }
+
+  const long count = (long)nnodes_last - nnodes_first + 1;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+  {
+    /* scratch buffers reused for all nnodes handled by a thread */
+    int divisors[MAX_DIVISORS_FOR_INT32];
+    int min_dims[ndims];
+    int tmp_dims[ndims];
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+    for (long k = 0; k < count; k++) {
+      int nnodes = nnodes_first + (int)k;
+      double sum = ones_sum;
+      if (nnodes == 1) {
+        for (int i = 0; i < ndims; i++) {
+          min_dims[i] = 1;
+        }
+      } else {
+        dims_divisors(nnodes, primes, nprimes, divisors);
+        sum = optdims_solve(nnodes, divisors, ndims, tmp_dim_weights,
+                            tmp_dims, min_dims);
+      }
+      for (int i = 0; i < ndims; i++) {
+        dims[permutation[i] * count + k] = min_dims[i];
+      }
+      if (objectives != NULL) {
+        objectives[k] = sum;
+      }
+    }
   }
 
+  free(primes);
   return MPI_SUCCESS;
 }
@@ -78,6 +78,40 @@ int MPI_Dims_weighted_create(const int nnodes, const int ndims,
 int PMPI_Dims_weighted_create(const int nnodes, const int ndims,
                               const double *dim_weights, int *dims);
 
+/** Compute dimensions based on weights for a range of process counts
+ *
+ * Equivalent to calling MPI_Dims_weighted_create with all dims set to zero
+ * for every nnodes in [nnodes_first, nnodes_last], but computes the divisors
+ * of all numbers from one sieve of the primes up to sqrt(nnodes_last) and
+ * reuses scratch buffers. Additional memory is O(sqrt(nnodes_last)),
+ * independent of the size of the range. Uses OpenMP threads if the library
+ * is configured with -DUSE_OPENMP=ON, in which case the number of threads is
+ * controlled as usual, e.g. by OMP_NUM_THREADS.
+ *
+ * Results are stored as struct of arrays: the value of dimension d for
+ * nnodes = nnodes_first + k is dims[d * count + k] with
+ * count = nnodes_last - nnodes_first + 1.
+ *
+ * @param[in] nnodes_first first number of processes
+ * @param[in] nnodes_last last number of processes
+ * @param[in] ndims number of dimensions
+ * @param[in] dim_weights weight factors for dimensions or MPI_EQUAL_WEIGHTS
+ * @param[out] dims computed optimal values for dimensions, ndims * count
+ *                  entries
+ * @param[out] objectives weighted sum \f$\sum_i \omega_i dims_i\f$ of the
+ *                        result for each nnodes, count entries, may be NULL
+ */
+int MPI_Dims_weighted_create_range(const int nnodes_first,
+                                   const int nnodes_last, const int ndims,
+                                   const double *dim_weights, int *dims,
+                                   double *objectives);
+
+/** PMPI interface corresponding to MPI call */
+int PMPI_Dims_weighted_create_range(const int nnodes_first,
+                                    const int nnodes_last, const int ndims,
+                                    const double *dim_weights, int *dims,
+                                    double *objectives);
+
 #if __cplusplus
 }
 #endif
@@ -0,0 +1,377 @@
+/*
+ * Copyright (c) 2026      High Performance Computing Center Stuttgart,
+ *                         University of Stuttgart.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER NOR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "MPI_Dims_weighted_redistribute.h"
+
+#include "MPI_Dims_weighted_create.h"
+#include "dims_candidates.h"
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** number of best process grids (by weighted sum) considered */
+#define MAX_DIMS_CANDIDATES 16
+
+/** block of a block distribution of global points over nblocks blocks */
+static void block_range(int global, int nblocks, int block, int *lo, int *hi) {
+  int base = global / nblocks;
+  int rest = global % nblocks;
+  *lo = block * base + (block < rest ? block : rest);
+  *hi = *lo + base + (block < rest ? 1 : 0);
+}
+
+/** block [lo, hi) owned by rank in a row-major process grid */
+static void rank_block(int ndims, const int *dims, const int *global_extents,
+                       int rank, int *lo, int *hi) {
+  for (int i = ndims - 1; i >= 0; i--) {
+    block_range(global_extents[i], dims[i], rank % dims[i], &lo[i], &hi[i]);
+    rank /= dims[i];
+  }
+}
+
+/** length of the intersection of [lo_a, hi_a) and [lo_b, hi_b) */
+static int overlap(int lo_a, int hi_a, int lo_b, int hi_b) {
+  int lo = (lo_a > lo_b) ? lo_a : lo_b;
+  int hi = (hi_a < hi_b) ? hi_a : hi_b;
+  return (hi > lo) ? hi - lo : 0;
+}
+
+/** advance row-major grid coordinates c to the next rank and update the
+ * blocks [lo, hi) of the changed axes, returns 1 if an axis other than the
+ * last one changed */
+static int next_coords(int ndims, const int *dims, const int *global_extents,
+                       int *c, int *lo, int *hi) {
+  int i = ndims - 1;
+  while (i >= 0 && ++c[i] == dims[i]) {
+    c[i] = 0;
+    block_range(global_extents[i], dims[i], 0, &lo[i], &hi[i]);
+    i--;
+  }
+  if (i >= 0) {
+    block_range(global_extents[i], dims[i], c[i], &lo[i], &hi[i]);
+  }
+  return i < ndims - 1;
+}
+
+/** number of grid points kept by the ranks present in both grids
+ *
+ * Walks the ranks with coordinate counters of both grids, the overlap of all
+ * but the last axis is only recomputed when one of these axes changes. */
+static double kept_points(int ndims, const int *old_dims, int old_nnodes,
+                          const int *new_dims, int new_nnodes,
+                          const int *global_extents) {
+  int nnodes = (old_nnodes < new_nnodes) ? old_nnodes : new_nnodes;
+  int last = ndims - 1;
+  int old_c[ndims], new_c[ndims];
+  int old_lo[ndims], old_hi[ndims], new_lo[ndims], new_hi[ndims];
+  for (int i = 0; i < ndims; i++) {
+    old_c[i] = new_c[i] = 0;
+    block_range(global_extents[i], old_dims[i], 0, &old_lo[i], &old_hi[i]);
+    block_range(global_extents[i], new_dims[i], 0, &new_lo[i], &new_hi[i]);
+  }
+  double prefix = -1.0;
+  double kept = 0.0;
+  for (int r = 0; r < nnodes; r++) {
+    if (prefix < 0.0) {
+      prefix = 1.0;
+      for (int i = 0; i < last; i++) {
+        prefix *= overlap(old_lo[i], old_hi[i], new_lo[i], new_hi[i]);
+      }
+    }
+    kept += prefix * overlap(old_lo[last], old_hi[last], new_lo[last],
+                             new_hi[last]);
+    if (next_coords(ndims, old_dims, global_extents, old_c, old_lo, old_hi)) {
+      prefix = -1.0;
+    }
+    if (next_coords(ndims, new_dims, global_extents, new_c, new_lo, new_hi)) {
+      prefix = -1.0;
+    }
+  }
+  return kept;
+}
+
+/** Intersect box [lo, hi) with all blocks of a process grid
+ *
+ * Stores rank, number of points and box of each non-empty intersection in
+ * rank order, if ranks is NULL only the intersections are counted.
+ *
+ * @return number of intersections or -1 if a count exceeds INT_MAX
+ */
+static int block_intersections(int ndims, const int *lo, const int *hi,
+                               const int *dims, const int *global_extents,
+                               int *ranks, int *counts, int *box_lo,
+                               int *box_hi) {
+  /* range [first, last] of grid coordinates overlapping the box per axis */
+  int first[ndims], last[ndims], c[ndims];
+  for (int i = 0; i < ndims; i++) {
+    if (hi[i] <= lo[i]) {
+      return 0;
+    }
+    first[i] = dims[i];
+    last[i] = -1;
+    for (int k = 0; k < dims[i]; k++) {
+      int block_lo, block_hi;
+      block_range(global_extents[i], dims[i], k, &block_lo, &block_hi);
+      if (block_lo < hi[i] && block_hi > lo[i] && block_hi > block_lo) {
+        first[i] = (k < first[i]) ? k : first[i];
+        last[i] = k;
+      }
+    }
+    if (last[i] < 0) {
+      return 0;
+    }
+    c[i] = first[i];
+  }
+
+  int n = 0;
+  for (;;) {
+    if (ranks != NULL) {
+      int rank = 0;
+      double points = 1.0;
+      for (int i = 0; i < ndims; i++) {
+        int block_lo, block_hi;
+        block_range(global_extents[i], dims[i], c[i], &block_lo, &block_hi);
+        int *l = &box_lo[n * ndims + i];
+        int *h = &box_hi[n * ndims + i];
+        *l = (block_lo > lo[i]) ? block_lo : lo[i];
+        *h = (block_hi < hi[i]) ? block_hi : hi[i];
+        points *= *h - *l;
+        rank = rank * dims[i] + c[i];
+      }
+      if (points > INT_MAX) {
+        return -1;
+      }
+      ranks[n] = rank;
+      counts[n] = (int)points;
+    }
+    n++;
+
+    /* next coordinate in row-major order */
+    int i = ndims - 1;
+    while (i >= 0 && c[i] == last[i]) {
+      c[i] = first[i];
+      i--;
+    }
+    if (i < 0) {
+      break;
+    }
+    c[i]++;
+  }
+  return n;
+}
+
+/** allocate and compute intersections of box [lo, hi) with a process grid */
+static int plan_blocks(int ndims, const int *lo, const int *hi, const int *dims,
+                       const int *global_extents, int *n, int **ranks,
+                       int **counts, int **box_lo, int **box_hi) {
+  *n = block_intersections(ndims, lo, hi, dims, global_extents, NULL, NULL,
+                           NULL, NULL);
+  *ranks = malloc((*n + 1) * sizeof(int));
+  *counts = malloc((*n + 1) * sizeof(int));
+  *box_lo = malloc((*n * ndims + 1) * sizeof(int));
+  *box_hi = malloc((*n * ndims + 1) * sizeof(int));
+  if (*ranks == NULL || *counts == NULL || *box_lo == NULL || *box_hi == NULL) {
+    return MPI_ERR_NO_MEM;
+  }
+  if (block_intersections(ndims, lo, hi, dims, global_extents, *ranks, *counts,
+                          *box_lo, *box_hi) < 0) {
+    return MPI_ERR_COUNT;
+  }
+  return MPI_SUCCESS;
+}
+
+int MPI_Dims_weighted_redistribute(int ndims, const int *old_dims,
+                                   int new_nnodes, const double *dim_weights,
+                                   const int *global_extents,
+                                   double redistribution_weight, int rank,
+                                   int *new_dims,
+                                   MPI_Redistribution_plan *plan) {
+  int ret = PMPI_Dims_weighted_redistribute(
+      ndims, old_dims, new_nnodes, dim_weights, global_extents,
+      redistribution_weight, rank, new_dims, plan);
+  return ret;
+}
+
+int PMPI_Dims_weighted_redistribute(int ndims, const int *old_dims,
+                                    int new_nnodes, const double *dim_weights,
+                                    const int *global_extents,
+                                    double redistribution_weight, int rank,
+                                    int *new_dims,
+                                    MPI_Redistribution_plan *plan) {
+  if (new_nnodes < 1 || redistribution_weight < 0.0) {
+    return MPI_ERR_ARG;
+  }
+  if (ndims < 1) {
+    return MPI_ERR_DIMS;
+  }
+  int old_nnodes = 1;
+  double global_points = 1.0;
+  for (int i = 0; i < ndims; i++) {
+    if (old_dims[i] < 1 || old_dims[i] > INT_MAX / old_nnodes) {
+      return MPI_ERR_DIMS;
+    }
+    if (global_extents[i] < 1) {
+      return MPI_ERR_ARG;
+    }
+    old_nnodes *= old_dims[i];
+    global_points *= global_extents[i];
+  }
+  if (plan != NULL &&
+      (rank < 0 || (rank >= old_nnodes && rank >= new_nnodes))) {
+    return MPI_ERR_RANK;
+  }
+
+  /* candidate 0 is the result of MPI_Dims_weighted_create so that ties and
+   * redistribution_weight 0 reproduce it */
+  int candidates[(MAX_DIMS_CANDIDATES + 1) * ndims];
+  for (int i = 0; i < ndims; i++) {
+    candidates[i] = 0;
+  }
+  int ret = PMPI_Dims_weighted_create(new_nnodes, ndims, dim_weights,
+                                      candidates);
+  if (ret != MPI_SUCCESS) {
+    return ret;
+  }
+  int ncandidates =
+      1 + dims_candidates(new_nnodes, ndims, dim_weights, MAX_DIMS_CANDIDATES,
+                          &candidates[ndims], NULL);
+
+  double min_objective = dims_objective(ndims, dim_weights, candidates);
+  double min_cost = -1.0;
+  for (int c = 0; c < ncandidates; c++) {
+    const int *cand = &candidates[c * ndims];
+    double cost = dims_objective(ndims, dim_weights, cand) / min_objective;
+    if (min_cost >= 0.0 && cost >= min_cost) {
+      /* candidates are sorted by objective and moving data only adds cost,
+       * so none of the remaining candidates can improve */
+      break;
+    }
+    if (c > 0 && memcmp(cand, candidates, ndims * sizeof(int)) == 0) {
+      continue; /* best candidate repeats the MPI_Dims_weighted_create one */
+    }
+    if (redistribution_weight > 0.0) {
+      double moved = global_points - kept_points(ndims, old_dims, old_nnodes,
+                                                 cand, new_nnodes,
+                                                 global_extents);
+      cost += redistribution_weight * moved / global_points;
+    }
+    if (min_cost < 0.0 || cost < min_cost) {
+      min_cost = cost;
+      memcpy(new_dims, cand, ndims * sizeof(int));
+    }
+  }
+
+  if (plan == NULL) {
+    return MPI_SUCCESS;
+  }
+
+  memset(plan, 0, sizeof(*plan));
+  plan->ndims = ndims;
+  int lo[ndims], hi[ndims];
+  if (rank < old_nnodes) {
+    rank_block(ndims, old_dims, global_extents, rank, lo, hi);
+  } else {
+    memset(hi, 0, sizeof(hi));
+    memset(lo, 0, sizeof(lo));
+  }
+  ret = plan_blocks(ndims, lo, hi, new_dims, global_extents, &plan->nsend,
+                    &plan->send_ranks, &plan->send_counts, &plan->send_lo,
+                    &plan->send_hi);
+  if (ret == MPI_SUCCESS) {
+    if (rank < new_nnodes) {
+      rank_block(ndims, new_dims, global_extents, rank, lo, hi);
+    } else {
+      memset(hi, 0, sizeof(hi));
+      memset(lo, 0, sizeof(lo));
+    }
+    ret = plan_blocks(ndims, lo, hi, old_dims, global_extents, &plan->nrecv,
+                      &plan->recv_ranks, &plan->recv_counts, &plan->recv_lo,
+                      &plan->recv_hi);
+  }
+  if (ret != MPI_SUCCESS) {
+    PMPI_Redistribution_plan_free(plan);
+  }
+  return ret;
+}
+
+int MPI_Redistribution_plan_alltoallv(const MPI_Redistribution_plan *plan,
+                                      int comm_size, int *sendcounts,
+                                      int *sdispls, int *recvcounts,
+                                      int *rdispls) {
+  int ret = PMPI_Redistribution_plan_alltoallv(plan, comm_size, sendcounts,
+                                               sdispls, recvcounts, rdispls);
+  return ret;
+}
+
+int PMPI_Redistribution_plan_alltoallv(const MPI_Redistribution_plan *plan,
+                                       int comm_size, int *sendcounts,
+                                       int *sdispls, int *recvcounts,
+                                       int *rdispls) {
+  for (int r = 0; r < comm_size; r++) {
+    sendcounts[r] = recvcounts[r] = 0;
+  }
+  for (int k = 0; k < plan->nsend; k++) {
+    if (plan->send_ranks[k] >= comm_size) {
+      return MPI_ERR_RANK;
+    }
+    sendcounts[plan->send_ranks[k]] = plan->send_counts[k];
+  }
+  for (int k = 0; k < plan->nrecv; k++) {
+    if (plan->recv_ranks[k] >= comm_size) {
+      return MPI_ERR_RANK;
+    }
+    recvcounts[plan->recv_ranks[k]] = plan->recv_counts[k];
+  }
+  int sdispl = 0, rdispl = 0;
+  for (int r = 0; r < comm_size; r++) {
+    sdispls[r] = sdispl;
+    rdispls[r] = rdispl;
+    sdispl += sendcounts[r];
+    rdispl += recvcounts[r];
+  }
+  return MPI_SUCCESS;
+}
+
+int MPI_Redistribution_plan_free(MPI_Redistribution_plan *plan) {
+  int ret = PMPI_Redistribution_plan_free(plan);
+  return ret;
+}
+
+int PMPI_Redistribution_plan_free(MPI_Redistribution_plan *plan) {
+  free(plan->send_ranks);
+  free(plan->send_counts);
+  free(plan->send_lo);
+  free(plan->send_hi);
+  free(plan->recv_ranks);
+  free(plan->recv_counts);
+  free(plan->recv_lo);
+  free(plan->recv_hi);
+  memset(plan, 0, sizeof(*plan));
+  return MPI_SUCCESS;
+}
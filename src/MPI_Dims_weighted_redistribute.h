@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026      High Performance Computing Center Stuttgart,
+ *                         University of Stuttgart.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER NOR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SRC_MPI_DIMS_WEIGHTED_REDISTRIBUTE_H_
+#define SRC_MPI_DIMS_WEIGHTED_REDISTRIBUTE_H_
+
+#include <mpi.h>
+
+#if __cplusplus
+extern "C" {
+#endif
+
+/** Data movement of one rank when changing the process grid
+ *
+ * The global grid is block distributed over the old and the new process grid,
+ * ranks are numbered row-major as by MPI_Cart_create without reordering.
+ * Blocks are half-open boxes [lo, hi) of global grid indices, the entries of
+ * one block are stored at lo[k * ndims] and hi[k * ndims]. Peers are sorted
+ * by rank and include the rank itself, so the plan maps directly to the
+ * arguments of MPI_Alltoallv or, with send_ranks and recv_ranks as
+ * destinations and sources of MPI_Dist_graph_create_adjacent, to a (persistent)
+ * MPI_Neighbor_alltoallv.
+ */
+typedef struct {
+  int ndims;
+  int nsend;        /**< number of blocks sent */
+  int *send_ranks;  /**< new rank receiving block k */
+  int *send_counts; /**< number of grid points in block k */
+  int *send_lo;     /**< lower corner of block k */
+  int *send_hi;     /**< upper corner (exclusive) of block k */
+  int nrecv;        /**< number of blocks received */
+  int *recv_ranks;  /**< old rank sending block k */
+  int *recv_counts; /**< number of grid points in block k */
+  int *recv_lo;     /**< lower corner of block k */
+  int *recv_hi;     /**< upper corner (exclusive) of block k */
+} MPI_Redistribution_plan;
+
+/** Compute dims for a changed number of processes and a redistribution plan
+ *
+ * Chooses new dims for new_nnodes processes minimizing
+ * \f[
+ *   \frac{\sum_i \omega_i dims_i}{\min \sum_i \omega_i dims_i} +
+ *   \text{redistribution\_weight} \cdot
+ *   \frac{\text{moved grid points}}{\text{global grid points}} ,
+ * \f]
+ * i.e. trades the objective of MPI_Dims_weighted_create against the amount
+ * of data that has to move to other ranks. With redistribution_weight 0 the
+ * result equals that of MPI_Dims_weighted_create.
+ *
+ * The 16 best grids by objective are considered. Counting the moved grid
+ * points takes one pass over the min(old, new) ranks present in both grids,
+ * which is only done for grids that can still improve on the best cost found.
+ *
+ * @param[in] ndims number of dimensions
+ * @param[in] old_dims dims of the current process grid
+ * @param[in] new_nnodes number of processes after redistribution
+ * @param[in] dim_weights weight factors for dimensions or MPI_EQUAL_WEIGHTS
+ * @param[in] global_extents number of global grid points in each dimension
+ * @param[in] redistribution_weight weight of the moved data fraction
+ * @param[in] rank rank for which the plan is computed, must be smaller than
+ *                 the old or the new number of processes
+ * @param[out] new_dims computed values for dimensions
+ * @param[out] plan blocks to send and receive by rank, may be NULL, has to be
+ *                  released with MPI_Redistribution_plan_free
+ */
+int MPI_Dims_weighted_redistribute(int ndims, const int *old_dims,
+                                   int new_nnodes, const double *dim_weights,
+                                   const int *global_extents,
+                                   double redistribution_weight, int rank,
+                                   int *new_dims,
+                                   MPI_Redistribution_plan *plan);
+
+/** PMPI interface corresponding to MPI call */
+int PMPI_Dims_weighted_redistribute(int ndims, const int *old_dims,
+                                    int new_nnodes, const double *dim_weights,
+                                    const int *global_extents,
+                                    double redistribution_weight, int rank,
+                                    int *new_dims,
+                                    MPI_Redistribution_plan *plan);
+
+/** Expand a plan to the count and displacement arrays of MPI_Alltoallv
+ *
+ * Blocks are packed contiguously in rank order.
+ *
+ * @param[in] plan redistribution plan
+ * @param[in] comm_size size of the communicator used for MPI_Alltoallv
+ * @param[out] sendcounts, sdispls, recvcounts, rdispls arrays of comm_size
+ *             entries in units of grid points
+ */
+int MPI_Redistribution_plan_alltoallv(const MPI_Redistribution_plan *plan,
+                                      int comm_size, int *sendcounts,
+                                      int *sdispls, int *recvcounts,
+                                      int *rdispls);
+
+/** PMPI interface corresponding to MPI call */
+int PMPI_Redistribution_plan_alltoallv(const MPI_Redistribution_plan *plan,
+                                       int comm_size, int *sendcounts,
+                                       int *sdispls, int *recvcounts,
+                                       int *rdispls);
+
+/** Release memory of a redistribution plan */
+int MPI_Redistribution_plan_free(MPI_Redistribution_plan *plan);
+
+/** PMPI interface corresponding to MPI call */
+int PMPI_Redistribution_plan_free(MPI_Redistribution_plan *plan);
+
+#if __cplusplus
+}
+#endif
+
+#endif // SRC_MPI_DIMS_WEIGHTED_REDISTRIBUTE_H_
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026      High Performance Computing Center Stuttgart,
+ *                         University of Stuttgart.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER NOR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "MPI_Info_get_json.h"
+
+#include <json-c/json.h>
+#include <stdlib.h>
+#include <string.h>
+
+int MPI_Info_get_json(MPI_Info info, int *buflen, char *json_str) {
+  int ret = PMPI_Info_get_json(info, buflen, json_str);
+  return ret;
+}
+
+int PMPI_Info_get_json(MPI_Info info, int *buflen, char *json_str) {
+  int nkeys;
+  int ret = MPI_Info_get_nkeys(info, &nkeys);
+  if (MPI_SUCCESS != ret) {
+    return ret;
+  }
+
+  struct json_object *jobj = json_object_new_object();
+  char key[MPI_MAX_INFO_KEY + 1];
+  int value_size = 0;
+  char *value = NULL;
+  for (int i = 0; i < nkeys; i++) {
+    int valuelen, flag;
+    ret = MPI_Info_get_nthkey(info, i, key);
+    if (MPI_SUCCESS == ret) {
+      ret = MPI_Info_get_valuelen(info, key, &valuelen, &flag);
+    }
+    if (MPI_SUCCESS != ret) {
+      break;
+    }
+    if (valuelen + 1 > value_size) {
+      value_size = 2 * (valuelen + 1);
+      char *new_value = realloc(value, value_size);
+      if (new_value == NULL) {
+        ret = MPI_ERR_NO_MEM;
+        break;
+      }
+      value = new_value;
+    }
+    ret = MPI_Info_get(info, key, valuelen, value, &flag);
+    if (MPI_SUCCESS != ret) {
+      break;
+    }
+    value[valuelen] = '\0';
+    json_object_object_add(jobj, key, json_object_new_string(value));
+  }
+  free(value);
+
+  if (MPI_SUCCESS == ret) {
+    const char *str = json_object_to_json_string_ext(
+        jobj, JSON_C_TO_STRING_PLAIN | JSON_C_TO_STRING_NOSLASHESCAPE);
+    int len = strlen(str);
+    if (*buflen > 0 && json_str != NULL) {
+      int n = (len < *buflen - 1) ? len : *buflen - 1;
+      memcpy(json_str, str, n);
+      json_str[n] = '\0';
+    }
+    *buflen = len + 1;
+  }
+  json_object_put(jobj);
+
+  return ret;
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026      High Performance Computing Center Stuttgart,
+ *                         University of Stuttgart.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER NOR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SRC_MPI_INFO_GET_JSON_H_
+#define SRC_MPI_INFO_GET_JSON_H_
+
+#include <mpi.h>
+
+#if __cplusplus
+extern "C" {
+#endif
+
+/** MPI_Info_get_json returns all (key,value) pairs of an MPI info as JSON
+ *
+ * MPI_Info_get_json is the counterpart of MPI_Info_set_json and serializes an
+ * info object into a JSON string with a dict containing key: value pairs.
+ * Following MPI_Info_get_string, buflen is the size of json_str on input and
+ * the size required for the JSON string including the terminating null
+ * character on output. If json_str is too small the string is truncated.
+ *
+ * Example call:
+ *   int buflen = 0;
+ *   MPI_Info_get_json(info, &buflen, NULL);
+ *   char *json_str = malloc(buflen);
+ *   MPI_Info_get_json(info, &buflen, json_str);
+ *
+ * @param[in]    info
+ * @param[inout] buflen length of json_str
+ * @param[out]   json_str JSON string, may be NULL if buflen is 0
+ */
+int MPI_Info_get_json(MPI_Info info, int *buflen, char *json_str);
+
+/** PMPI interface corresponding to MPI call */
+int PMPI_Info_get_json(MPI_Info info, int *buflen, char *json_str);
+
+#if __cplusplus
+}
+#endif
+
+#endif // SRC_MPI_INFO_GET_JSON_H_
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026      High Performance Computing Center Stuttgart,
+ *                         University of Stuttgart.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER NOR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "MPI_Info_snapshot.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Snapshot layout, all integers int32_t in native byte order:
+ *
+ *   magic, nkeys,
+ *   nkeys times: keylen, valuelen, key, '\0', value, '\0'
+ */
+#define INFO_SNAPSHOT_MAGIC 0x4d504969 /* "MPIi" */
+
+struct snapshot_buffer {
+  char *data;
+  size_t size;
+  size_t capacity;
+};
+
+/** make room for n more bytes */
+static int snapshot_reserve(struct snapshot_buffer *buffer, size_t n) {
+  if (buffer->size + n <= buffer->capacity) {
+    return MPI_SUCCESS;
+  }
+  size_t capacity = 2 * buffer->capacity;
+  if (capacity < buffer->size + n) {
+    capacity = buffer->size + n;
+  }
+  char *data = realloc(buffer->data, capacity);
+  if (data == NULL) {
+    return MPI_ERR_NO_MEM;
+  }
+  buffer->data = data;
+  buffer->capacity = capacity;
+  return MPI_SUCCESS;
+}
+
+static void snapshot_put_int(struct snapshot_buffer *buffer, int32_t value) {
+  memcpy(&buffer->data[buffer->size], &value, sizeof(value));
+  buffer->size += sizeof(value);
+}
+
+int MPI_Info_snapshot(MPI_Info info, int *size, void **buf) {
+  int ret = PMPI_Info_snapshot(info, size, buf);
+  return ret;
+}
+
+int PMPI_Info_snapshot(MPI_Info info, int *size, void **buf) {
+  int nkeys;
+  int ret = MPI_Info_get_nkeys(info, &nkeys);
+  if (MPI_SUCCESS != ret) {
+    return ret;
+  }
+
+  /* initial guess of 32 bytes per pair, grows by doubling */
+  struct snapshot_buffer buffer = {NULL, 0, 0};
+  ret = snapshot_reserve(&buffer, 2 * sizeof(int32_t) + 32 * (size_t)nkeys);
+  if (MPI_SUCCESS != ret) {
+    return ret;
+  }
+  snapshot_put_int(&buffer, INFO_SNAPSHOT_MAGIC);
+  snapshot_put_int(&buffer, nkeys);
+
+  char key[MPI_MAX_INFO_KEY + 1];
+  for (int i = 0; i < nkeys && MPI_SUCCESS == ret; i++) {
+    int valuelen, flag;
+    ret = MPI_Info_get_nthkey(info, i, key);
+    if (MPI_SUCCESS == ret) {
+      ret = MPI_Info_get_valuelen(info, key, &valuelen, &flag);
+    }
+    if (MPI_SUCCESS != ret) {
+      break;
+    }
+    int keylen = strlen(key);
+    ret = snapshot_reserve(&buffer,
+                           2 * sizeof(int32_t) + keylen + valuelen + 2);
+    if (MPI_SUCCESS != ret) {
+      break;
+    }
+    snapshot_put_int(&buffer, keylen);
+    snapshot_put_int(&buffer, valuelen);
+    memcpy(&buffer.data[buffer.size], key, keylen + 1);
+    buffer.size += keylen + 1;
+    /* value is read directly into the snapshot */
+    ret = MPI_Info_get(info, key, valuelen, &buffer.data[buffer.size], &flag);
+    buffer.data[buffer.size + valuelen] = '\0';
+    buffer.size += valuelen + 1;
+  }
+
+  if (MPI_SUCCESS == ret && buffer.size > INT32_MAX) {
+    ret = MPI_ERR_COUNT;
+  }
+  if (MPI_SUCCESS != ret) {
+    free(buffer.data);
+    return ret;
+  }
+  *size = (int)buffer.size;
+  *buf = buffer.data;
+  return MPI_SUCCESS;
+}
+
+int MPI_Info_restore(const void *buf, int size, MPI_Info info) {
+  int ret = PMPI_Info_restore(buf, size, info);
+  return ret;
+}
+
+int PMPI_Info_restore(const void *buf, int size, MPI_Info info) {
+  const char *data = buf;
+  const char *end = data + size;
+  int32_t magic, nkeys;
+
+  if (size < (int)(2 * sizeof(int32_t))) {
+    return MPI_ERR_ARG;
+  }
+  memcpy(&magic, data, sizeof(magic));
+  memcpy(&nkeys, data + sizeof(magic), sizeof(nkeys));
+  if (magic != INFO_SNAPSHOT_MAGIC || nkeys < 0) {
+    return MPI_ERR_ARG;
+  }
+  data += 2 * sizeof(int32_t);
+
+  for (int32_t i = 0; i < nkeys; i++) {
+    int32_t keylen, valuelen;
+    if (end - data < (ptrdiff_t)(2 * sizeof(int32_t))) {
+      return MPI_ERR_ARG;
+    }
+    memcpy(&keylen, data, sizeof(keylen));
+    memcpy(&valuelen, data + sizeof(keylen), sizeof(valuelen));
+    data += 2 * sizeof(int32_t);
+    if (keylen < 0 || valuelen < 0 ||
+        end - data < (ptrdiff_t)keylen + valuelen + 2 ||
+        data[keylen] != '\0' || data[keylen + 1 + valuelen] != '\0') {
+      return MPI_ERR_ARG;
+    }
+    int ret = MPI_Info_set(info, data, data + keylen + 1);
+    if (MPI_SUCCESS != ret) {
+      return ret;
+    }
+    data += keylen + valuelen + 2;
+  }
+
+  return MPI_SUCCESS;
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026      High Performance Computing Center Stuttgart,
+ *                         University of Stuttgart.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER NOR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SRC_MPI_INFO_SNAPSHOT_H_
+#define SRC_MPI_INFO_SNAPSHOT_H_
+
+#include <mpi.h>
+
+#if __cplusplus
+extern "C" {
+#endif
+
+/** MPI_Info_snapshot serializes an MPI info into one contiguous buffer
+ *
+ * The buffer contains all (key,value) pairs in a compact binary format and
+ * can be sent as MPI_BYTE, e.g. to spawned processes, and applied to another
+ * info object with MPI_Info_restore. The format uses the native byte order,
+ * so it is only portable between processes of the same architecture.
+ *
+ * Example call:
+ *   void *buf;
+ *   int size;
+ *   MPI_Info_snapshot(info, &size, &buf);
+ *   MPI_Bcast(buf, size, MPI_BYTE, 0, comm);
+ *   free(buf);
+ *
+ * @param[in]  info
+ * @param[out] size size of the buffer in bytes
+ * @param[out] buf buffer allocated with malloc, has to be released with free
+ */
+int MPI_Info_snapshot(MPI_Info info, int *size, void **buf);
+
+/** PMPI interface corresponding to MPI call */
+int PMPI_Info_snapshot(MPI_Info info, int *size, void **buf);
+
+/** MPI_Info_restore sets all (key,value) pairs of a snapshot to an MPI info
+ *
+ * Keys and values are passed to MPI_Info_set directly from the buffer in a
+ * single pass without further copies.
+ *
+ * @param[in]    buf buffer created by MPI_Info_snapshot
+ * @param[in]    size size of the buffer in bytes
+ * @param[inout] info
+ */
+int MPI_Info_restore(const void *buf, int size, MPI_Info info);
+
+/** PMPI interface corresponding to MPI call */
+int PMPI_Info_restore(const void *buf, int size, MPI_Info info);
+
+#if __cplusplus
+}
+#endif
+
+#endif // SRC_MPI_INFO_SNAPSHOT_H_
@@ -0,0 +1,418 @@
+/*
+ * Copyright (c) 2026      High Performance Computing Center Stuttgart,
+ *                         University of Stuttgart.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER NOR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dims_candidates.h"
+
+#include "MPI_Dims_weighted_create.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+/** hook invoked for every node visited by the dims_candidates() search, e.g.
+ * to count search nodes in tests; expands to nothing by default */
+#ifndef DIMS_CANDIDATES_NODE_HOOK
+#define DIMS_CANDIDATES_NODE_HOOK()
+#endif
+
+/** child of a search node: pair index and bound of its best candidate */
+struct child {
+  double bound;
+  int pair;
+};
+
+struct candidate_list {
+  int ndims;
+  int ndivisors;
+  const int *divisors;
+  const double *dim_weights;
+  /* search order: weights in increasing order, original dimension of each
+   * sorted weight and last dimension of each run of equal weights */
+  const double *sorted_weights;
+  const int *permutation;
+  const int *run_last;
+  /* factorizations of divisor a into divisors pair_factor[j] * pair_rest[j]
+   * for pair_start[a] <= j < pair_start[a + 1], by increasing factor */
+  const int *pair_start;
+  const int *pair_factor;
+  const int *pair_rest;
+  /* smallest weighted sum of the sorted dimensions i.. with product divisor
+   * a, stored at bound[i * ndivisors + a] */
+  const double *bound;
+  /* scratch space of ndivisors children per dimension */
+  struct child *children;
+  int max_candidates;
+  int count;
+  int *candidates;
+  double *objectives;
+};
+
+double dims_objective(int ndims, const double *dim_weights, const int *dims) {
+  double sum = 0.0;
+  for (int i = 0; i < ndims; i++) {
+    sum += (dim_weights == MPI_EQUAL_WEIGHTS ? 1.0 : dim_weights[i]) * dims[i];
+  }
+  return sum;
+}
+
+/** insert dims into list sorted by objective, drop worst if list is full
+ * @return 1 if dims were inserted, otherwise 0 */
+static int candidate_insert(struct candidate_list *list, const int *dims) {
+  const int ndims = list->ndims;
+  double objective = dims_objective(ndims, list->dim_weights, dims);
+  int pos = list->count;
+  while (pos > 0 && list->objectives[pos - 1] > objective) {
+    pos--;
+  }
+  if (pos >= list->max_candidates) {
+    return 0;
+  }
+  int last = list->count < list->max_candidates ? list->count
+                                                 : list->max_candidates - 1;
+  for (int k = last; k > pos; k--) {
+    list->objectives[k] = list->objectives[k - 1];
+    for (int i = 0; i < ndims; i++) {
+      list->candidates[k * ndims + i] = list->candidates[(k - 1) * ndims + i];
+    }
+  }
+  list->objectives[pos] = objective;
+  for (int i = 0; i < ndims; i++) {
+    list->candidates[pos * ndims + i] = dims[i];
+  }
+  if (list->count < list->max_candidates) {
+    list->count++;
+  }
+  return 1;
+}
+
+static int compare_descending(const void *a, const void *b) {
+  int x = *(const int *)a;
+  int y = *(const int *)b;
+  return (x < y) - (x > y);
+}
+
+int dims_divisors(int n, const int *primes, int nprimes, int *divisors) {
+  int count = 1;
+  divisors[0] = 1;
+  int i = 0;
+  int f = 2;
+  while (n > 1) {
+    /* next trial factor, remaining n without factor up to sqrt(n) is prime */
+    int p;
+    if (primes != NULL) {
+      p = (i < nprimes && primes[i] <= n / primes[i]) ? primes[i++] : n;
+    } else {
+      p = (f <= n / f) ? f : n;
+      f = (f == 2) ? 3 : f + 2;
+    }
+    int exponent = 0;
+    while (n % p == 0) {
+      n /= p;
+      exponent++;
+    }
+    /* multiply all known divisors by p, p^2, ..., p^exponent */
+    int known = count;
+    int factor = 1;
+    for (int e = 1; e <= exponent; e++) {
+      factor *= p;
+      for (int j = 0; j < known; j++) {
+        divisors[count++] = divisors[j] * factor;
+      }
+    }
+  }
+  qsort(divisors, count, sizeof(int), compare_descending);
+  return count;
+}
+
+void dims_sort_weights(int ndims, const double *dim_weights,
+                       double *sorted_dim_weights, int *permutation) {
+  if (dim_weights == MPI_EQUAL_WEIGHTS) {
+    for (int i = 0; i < ndims; i++) {
+      sorted_dim_weights[i] = 1.0;
+    }
+  } else {
+    for (int i = 0; i < ndims; i++) {
+      sorted_dim_weights[i] = dim_weights[i];
+    }
+  }
+
+  for (int i = 0; i < ndims; i++) {
+    permutation[i] = i;
+  }
+  for (int i = 0; i < ndims; i++) {
+    for (int j = i + 1; j < ndims; j++) {
+      if (sorted_dim_weights[i] > sorted_dim_weights[j]) {
+        double tmp_weight = sorted_dim_weights[i];
+        sorted_dim_weights[i] = sorted_dim_weights[j];
+        sorted_dim_weights[j] = tmp_weight;
+        int tmp_i = permutation[i];
+        permutation[i] = permutation[j];
+        permutation[j] = tmp_i;
+      }
+    }
+  }
+}
+
+/** next distinct permutation of a multiset in lexicographic order, returns 0
+ * and restores increasing order after the last one */
+static int next_multiset_permutation(int n, int *values) {
+  int i = n - 2;
+  while (i >= 0 && values[i] >= values[i + 1]) {
+    i--;
+  }
+  if (i >= 0) {
+    int j = n - 1;
+    while (values[j] <= values[i]) {
+      j--;
+    }
+    int tmp = values[i];
+    values[i] = values[j];
+    values[j] = tmp;
+  }
+  for (int l = i + 1, r = n - 1; l < r; l++, r--) {
+    int tmp = values[l];
+    values[l] = values[r];
+    values[r] = tmp;
+  }
+  return i >= 0;
+}
+
+/** insert dims (in sorted weight order, non-decreasing within runs of equal
+ * weights) with all distinct orders of the runs starting at dimension start
+ * @return 0 if an order was rejected by the full list, otherwise 1 */
+static int insert_run_orders(struct candidate_list *list, int *dims,
+                             int start) {
+  const int ndims = list->ndims;
+  if (start == ndims) {
+    int original_dims[ndims];
+    for (int i = 0; i < ndims; i++) {
+      original_dims[list->permutation[i]] = dims[i];
+    }
+    return candidate_insert(list, original_dims);
+  }
+  int n = list->run_last[start] - start + 1;
+  do {
+    if (!insert_run_orders(list, dims, list->run_last[start] + 1)) {
+      /* all orders have the same objective, so the remaining ones would be
+       * rejected as well; restore the increasing order of the run */
+      for (int i = start + 1; i < start + n; i++) {
+        int value = dims[i];
+        int j = i;
+        for (; j > start && dims[j - 1] > value; j--) {
+          dims[j] = dims[j - 1];
+        }
+        dims[j] = value;
+      }
+      return 0;
+    }
+  } while (next_multiset_permutation(n, &dims[start]));
+  return 1;
+}
+
+/** k^e > p for k >= 1 */
+static int power_exceeds(int k, int e, int p) {
+  long long v = 1;
+  for (int l = 0; l < e && v <= p; l++) {
+    v *= k;
+  }
+  return v > p;
+}
+
+static int compare_children(const void *a, const void *b) {
+  double x = ((const struct child *)a)->bound;
+  double y = ((const struct child *)b)->bound;
+  return (x > y) - (x < y);
+}
+
+/** list is full and a candidate with objective sum would be rejected, ties
+ * with the worst kept objective are rejected as well */
+static int candidate_rejected(const struct candidate_list *list, double sum) {
+  if (list->count < list->max_candidates) {
+    return 0;
+  }
+  double worst = list->objectives[list->max_candidates - 1];
+  return sum >= worst - 1e-12 * fabs(worst);
+}
+
+/** recursively assign a factor of the remaining product divisors[a] to sorted
+ * dimension i, factors are non-decreasing within runs of equal weights
+ *
+ * Children are visited in order of the smallest weighted sum they can reach,
+ * so that good candidates fill the list first, and the remaining children are
+ * cut once this bound reaches the worst kept objective. */
+static void enumerate(struct candidate_list *list, int a, int i, int *dims,
+                      double sum) {
+  DIMS_CANDIDATES_NODE_HOOK();
+  const int ndivisors = list->ndivisors;
+  int p = list->divisors[a];
+  int in_run =
+      (i > 0 && list->sorted_weights[i - 1] == list->sorted_weights[i]);
+  if (i == list->ndims - 1) {
+    if (in_run && p < dims[i - 1]) {
+      return;
+    }
+    dims[i] = p;
+    insert_run_orders(list, dims, 0);
+    return;
+  }
+  int first = in_run ? dims[i - 1] : 1;
+  int run_rest = list->run_last[i] - i;
+  struct child *children = &list->children[i * ndivisors];
+  int nchildren = 0;
+  for (int j = list->pair_start[a]; j < list->pair_start[a + 1]; j++) {
+    int k = list->divisors[list->pair_factor[j]];
+    if (k < first) {
+      continue;
+    }
+    if (power_exceeds(k, run_rest + 1, p)) {
+      break; /* remaining factors of the run would be smaller than k */
+    }
+    children[nchildren].bound =
+        sum + list->sorted_weights[i] * k +
+        list->bound[(i + 1) * ndivisors + list->pair_rest[j]];
+    children[nchildren].pair = j;
+    nchildren++;
+  }
+  qsort(children, nchildren, sizeof(struct child), compare_children);
+  for (int c = 0; c < nchildren; c++) {
+    if (candidate_rejected(list, children[c].bound)) {
+      break;
+    }
+    int j = children[c].pair;
+    int k = list->divisors[list->pair_factor[j]];
+    dims[i] = k;
+    enumerate(list, list->pair_rest[j], i + 1, dims,
+              sum + list->sorted_weights[i] * k);
+  }
+}
+
+/** index of divisor d in the descending divisor list */
+static int divisor_index(int ndivisors, const int *divisors, int d) {
+  int lo = 0;
+  int hi = ndivisors - 1;
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (divisors[mid] > d) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+int dims_candidates(int nnodes, int ndims, const double *dim_weights,
+                    int max_candidates, int *candidates, double *objectives) {
+  if (nnodes < 1 || ndims < 1 || max_candidates < 1) {
+    return 0;
+  }
+  int divisors[MAX_DIVISORS_FOR_INT32];
+  const int ndivisors = dims_divisors(nnodes, NULL, 0, divisors);
+
+  double sorted_weights[ndims];
+  int permutation[ndims];
+  dims_sort_weights(ndims, dim_weights, sorted_weights, permutation);
+  int run_last[ndims];
+  for (int i = ndims - 1; i >= 0; i--) {
+    run_last[i] = (i < ndims - 1 && sorted_weights[i] == sorted_weights[i + 1])
+                      ? run_last[i + 1]
+                      : i;
+  }
+
+  /* all factorizations of all divisors into two divisors */
+  int pair_start[ndivisors + 1];
+  int npairs = 0;
+  for (int a = 0; a < ndivisors; a++) {
+    for (int b = ndivisors - 1; b >= a; b--) {
+      npairs += (divisors[a] % divisors[b] == 0);
+    }
+  }
+  int *pair_factor = malloc(npairs * sizeof(int));
+  int *pair_rest = malloc(npairs * sizeof(int));
+  double *bound = malloc((size_t)ndims * ndivisors * sizeof(double));
+  struct child *children =
+      malloc((size_t)ndims * ndivisors * sizeof(struct child));
+  double *tmp_objectives = objectives;
+  if (tmp_objectives == NULL) {
+    tmp_objectives = malloc(max_candidates * sizeof(double));
+  }
+  int count = 0;
+  if (pair_factor != NULL && pair_rest != NULL && bound != NULL &&
+      children != NULL && tmp_objectives != NULL) {
+    npairs = 0;
+    for (int a = 0; a < ndivisors; a++) {
+      pair_start[a] = npairs;
+      for (int b = ndivisors - 1; b >= a; b--) {
+        if (divisors[a] % divisors[b] == 0) {
+          pair_factor[npairs] = b;
+          pair_rest[npairs] =
+              divisor_index(ndivisors, divisors, divisors[a] / divisors[b]);
+          npairs++;
+        }
+      }
+    }
+    pair_start[ndivisors] = npairs;
+
+    /* exact bounds by dynamic programming from the last dimension */
+    for (int a = 0; a < ndivisors; a++) {
+      bound[(ndims - 1) * ndivisors + a] =
+          sorted_weights[ndims - 1] * divisors[a];
+    }
+    for (int i = ndims - 2; i >= 0; i--) {
+      for (int a = 0; a < ndivisors; a++) {
+        double min = INFINITY;
+        for (int j = pair_start[a]; j < pair_start[a + 1]; j++) {
+          double sum = sorted_weights[i] * divisors[pair_factor[j]] +
+                       bound[(i + 1) * ndivisors + pair_rest[j]];
+          min = (sum < min) ? sum : min;
+        }
+        bound[i * ndivisors + a] = min;
+      }
+    }
+
+    struct candidate_list list = {ndims,          ndivisors,
+                                  divisors,       dim_weights,
+                                  sorted_weights, permutation,
+                                  run_last,       pair_start,
+                                  pair_factor,    pair_rest,
+                                  bound,          children,
+                                  max_candidates, 0,
+                                  candidates,     tmp_objectives};
+    int dims[ndims];
+    enumerate(&list, 0, 0, dims, 0.0);
+    count = list.count;
+  }
+
+  if (objectives == NULL) {
+    free(tmp_objectives);
+  }
+  free(children);
+  free(bound);
+  free(pair_rest);
+  free(pair_factor);
+  return count;
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026      High Performance Computing Center Stuttgart,
+ *                         University of Stuttgart.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER NOR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SRC_DIMS_CANDIDATES_H_
+#define SRC_DIMS_CANDIDATES_H_
+
+/** Internal helpers shared by the extensions building on
+ * MPI_Dims_weighted_create, not part of the installed interface. */
+
+#if __cplusplus
+extern "C" {
+#endif
+
+/** maximum number of divisors for int32 (int max~2.1e9) is 1600, reached by
+ * 2095133040 (http://oeis.org/A066150 only lists 1344 up to 1e9) */
+#define MAX_DIVISORS_FOR_INT32 1600
+
+/** Return list of divisors
+ *
+ * Factorizes n by trial division over the given primes or, if primes is NULL,
+ * over 2 and all odd numbers, and builds the divisors from the factorization.
+ *
+ * @param[in] n number for which divisors shall be computed
+ * @param[in] primes all primes up to at least sqrt(n) in increasing order or
+ *                   NULL
+ * @param[in] nprimes number of primes
+ * @param[out] divisors list of divisors in descending order ending with 1,
+ *                      array of at least MAX_DIVISORS_FOR_INT32 entries
+ * @return number of divisors
+ */
+int dims_divisors(int n, const int *primes, int nprimes, int *divisors);
+
+/** Enumerate candidate dims for a process grid
+ *
+ * Returns the max_candidates ordered factorizations of nnodes into ndims
+ * factors with the smallest weighted sum \f$\sum_i \omega_i dims_i\f$. The
+ * branch-and-bound search visits factors in non-decreasing order within runs
+ * of equal weights only and inserts all orders of such a run at once. Exact
+ * bounds for the remaining dimensions, computed by dynamic programming over
+ * the divisors of nnodes, order the search and cut branches that cannot
+ * improve on a full list. Additional memory is O(ndims * d(nnodes)) plus
+ * the number of divisor pairs of nnodes.
+ *
+ * @param[in] nnodes number of processes
+ * @param[in] ndims number of dimensions
+ * @param[in] dim_weights weight factors for dimensions or MPI_EQUAL_WEIGHTS
+ * @param[in] max_candidates maximum number of candidates to return
+ * @param[out] candidates array of max_candidates * ndims entries, candidate k
+ *                        is stored at candidates[k * ndims]
+ * @param[out] objectives weighted sums of the candidates, may be NULL
+ * @return number of candidates, sorted by increasing weighted sum, 0 if memory
+ *         could not be allocated
+ */
+int dims_candidates(int nnodes, int ndims, const double *dim_weights,
+                    int max_candidates, int *candidates, double *objectives);
+
+/** Sort weights in increasing order
+ *
+ * @param[in] ndims number of dimensions
+ * @param[in] dim_weights weight factors for dimensions or MPI_EQUAL_WEIGHTS
+ * @param[out] sorted_dim_weights weights in increasing order
+ * @param[out] permutation original dimension of each sorted weight
+ */
+void dims_sort_weights(int ndims, const double *dim_weights,
+                       double *sorted_dim_weights, int *permutation);
+
+/** Weighted sum \f$\sum_i \omega_i dims_i\f$ of dims
+ *
+ * @param[in] ndims number of dimensions
+ * @param[in] dim_weights weight factors for dimensions or MPI_EQUAL_WEIGHTS
+ * @param[in] dims dimensions
+ */
+double dims_objective(int ndims, const double *dim_weights, const int *dims);
+
+#if __cplusplus
+}
+#endif
+
+#endif // SRC_DIMS_CANDIDATES_H_
@@ -1,6 +1,11 @@
 #ifndef MPI_EXTENSIONS_H
 #define MPI_EXTENSIONS_H
 
+#include "MPI_Cart_topo_weighted_create.h"
 #include "MPI_Dims_weighted_create.h"
+#include "MPI_Dims_weighted_redistribute.h"
+#include "MPI_Info_get_json.h"
+#include "MPI_Info_set_json.h"
+#include "MPI_Info_snapshot.h"
 
 #endif  /* MPI_EXTENSIONS_H */
\ No newline at end of file
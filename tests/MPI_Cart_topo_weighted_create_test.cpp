@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2026      High Performance Computing Center Stuttgart,
+ *                         University of Stuttgart.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER NOR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define CATCH_CONFIG_RUNNER
+#define CATCH_CONFIG_CONSOLE_WIDTH 100
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_session.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "MPI_Cart_topo_weighted_create.h"
+#include "MPI_Dims_weighted_create.h"
+#include <mpi.h>
+
+int main(int argc, char *argv[]) {
+  MPI_Init(&argc, &argv);
+  int result = Catch::Session().run(argc, argv);
+  MPI_Finalize();
+  return result;
+}
+
+static std::string write_topo_file(const std::string &name,
+                                   const std::string &json) {
+  std::ofstream file(name);
+  file << json;
+  return name;
+}
+
+/* every grid position has to be assigned to exactly one rank */
+static void require_bijection(int nnodes, int ndims, const int *dims,
+                              const std::vector<int> &coords) {
+  std::set<std::vector<int>> positions;
+  for (int r = 0; r < nnodes; r++) {
+    std::vector<int> c(coords.begin() + r * ndims,
+                       coords.begin() + (r + 1) * ndims);
+    for (int i = 0; i < ndims; i++) {
+      REQUIRE(c[i] >= 0);
+      REQUIRE(c[i] < dims[i]);
+    }
+    positions.insert(c);
+  }
+  REQUIRE(positions.size() == (size_t)nnodes);
+}
+
+TEST_CASE("topology error checks for wrong input working",
+          "[MPI_Dims_topo_weighted_create]") {
+  std::string topo =
+      write_topo_file("topo_torus_4x4.json",
+                      "{\"type\": \"torus\", \"extents\": [4, 4]}");
+  int dims[2] = {0, 0};
+  std::vector<int> coords(2 * 32);
+
+  SECTION("if nnodes less than one return failure") {
+    int ret = MPI_Dims_topo_weighted_create(0, 2, MPI_EQUAL_WEIGHTS, NULL,
+                                            topo.c_str(), dims, coords.data());
+    REQUIRE(ret != MPI_SUCCESS);
+  }
+  SECTION("if machine has too few nodes return failure") {
+    int ret = MPI_Dims_topo_weighted_create(32, 2, MPI_EQUAL_WEIGHTS, NULL,
+                                            topo.c_str(), dims, coords.data());
+    REQUIRE(ret != MPI_SUCCESS);
+  }
+  SECTION("if topology file is missing return failure") {
+    int ret = MPI_Dims_topo_weighted_create(16, 2, MPI_EQUAL_WEIGHTS, NULL,
+                                            "does_not_exist.json", dims,
+                                            coords.data());
+    REQUIRE(ret != MPI_SUCCESS);
+  }
+  SECTION("if topology type is unknown return failure") {
+    std::string bad = write_topo_file("topo_unknown.json",
+                                      "{\"type\": \"hypercube\"}");
+    int ret = MPI_Dims_topo_weighted_create(16, 2, MPI_EQUAL_WEIGHTS, NULL,
+                                            bad.c_str(), dims, coords.data());
+    REQUIRE(ret != MPI_SUCCESS);
+  }
+  SECTION("if topology type is not a string return failure") {
+    std::string bad =
+        write_topo_file("topo_null_type.json", "{\"type\": null}");
+    int ret = MPI_Dims_topo_weighted_create(16, 2, MPI_EQUAL_WEIGHTS, NULL,
+                                            bad.c_str(), dims, coords.data());
+    REQUIRE(ret != MPI_SUCCESS);
+  }
+}
+
+TEST_CASE("torus embedding", "[MPI_Dims_topo_weighted_create]") {
+  SECTION("2D grid is folded onto transposed 2D torus") {
+    /* MPI_Dims_weighted_create returns 4x8 for these weights, the torus is
+     * 8x4, so the embedding has to fold the grid onto the torus */
+    std::string topo =
+        write_topo_file("topo_torus_8x4.json",
+                        "{\"type\": \"torus\", \"extents\": [8, 4]}");
+    int nnodes = 32;
+    int ndims = 2;
+    double dim_weights[] = {1. / 64., 1. / 128.};
+    int periods[] = {1, 1};
+    int dims[2] = {0, 0};
+    std::vector<int> coords(nnodes * ndims);
+    int ret = MPI_Dims_topo_weighted_create(nnodes, ndims, dim_weights,
+                                            periods, topo.c_str(), dims,
+                                            coords.data());
+    REQUIRE(ret == MPI_SUCCESS);
+    REQUIRE(dims[0] * dims[1] == nnodes);
+    require_bijection(nnodes, ndims, dims, coords);
+
+    std::vector<int> rank_of(nnodes);
+    for (int r = 0; r < nnodes; r++) {
+      rank_of[coords[r * ndims] * dims[1] + coords[r * ndims + 1]] = r;
+    }
+    const int extents[] = {8, 4};
+    for (int r = 0; r < nnodes; r++) {
+      for (int i = 0; i < ndims; i++) {
+        int c[2] = {coords[r * ndims], coords[r * ndims + 1]};
+        c[i] = (c[i] + 1) % dims[i];
+        int n = rank_of[c[0] * dims[1] + c[1]];
+        /* torus distance between node r and node n, numbered row-major */
+        int hops = 0;
+        int a[2] = {r / extents[1], r % extents[1]};
+        int b[2] = {n / extents[1], n % extents[1]};
+        for (int k = 0; k < 2; k++) {
+          int d = std::abs(a[k] - b[k]);
+          hops += std::min(d, extents[k] - d);
+        }
+        REQUIRE(hops == 1);
+      }
+    }
+  }
+
+  SECTION("ranks of a node form a compact tile") {
+    std::string topo = write_topo_file(
+        "topo_ring_8.json",
+        "{\"type\": \"torus\", \"extents\": [8], \"ranks_per_node\": 4}");
+    int nnodes = 32;
+    int ndims = 2;
+    int dims[2] = {0, 0};
+    std::vector<int> coords(nnodes * ndims);
+    int ret = MPI_Dims_topo_weighted_create(nnodes, ndims, MPI_EQUAL_WEIGHTS,
+                                            NULL, topo.c_str(), dims,
+                                            coords.data());
+    REQUIRE(ret == MPI_SUCCESS);
+    REQUIRE(dims[0] * dims[1] == nnodes);
+    require_bijection(nnodes, ndims, dims, coords);
+    for (int node = 0; node < 8; node++) {
+      for (int i = 0; i < ndims; i++) {
+        int lo = dims[i], hi = 0;
+        for (int r = 4 * node; r < 4 * (node + 1); r++) {
+          lo = std::min(lo, coords[r * ndims + i]);
+          hi = std::max(hi, coords[r * ndims + i]);
+        }
+        REQUIRE(hi - lo == 1);
+      }
+    }
+  }
+}
+
+TEST_CASE("many dimensions are searched in bounded time",
+          "[MPI_Dims_topo_weighted_create]") {
+  // enumerating all ordered factorizations took 25 s here
+  std::string topo = write_topo_file(
+      "topo_torus_16x16x16x16.json",
+      "{\"type\": \"torus\", \"extents\": [16, 16, 16, 16]}");
+  int nnodes = 65536;
+  int ndims = 16;
+  std::vector<int> dims(ndims, 0);
+  std::vector<int> coords(nnodes * ndims);
+  auto start = std::chrono::steady_clock::now();
+  int ret = MPI_Dims_topo_weighted_create(nnodes, ndims, MPI_EQUAL_WEIGHTS,
+                                          NULL, topo.c_str(), dims.data(),
+                                          coords.data());
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  REQUIRE(ret == MPI_SUCCESS);
+  REQUIRE(elapsed.count() < 5.0);
+  int product = 1;
+  for (int i = 0; i < ndims; i++) {
+    product *= dims[i];
+  }
+  REQUIRE(product == nnodes);
+}
+
+TEST_CASE("dragonfly embedding", "[MPI_Dims_topo_weighted_create]") {
+  std::string topo = write_topo_file(
+      "topo_dragonfly.json",
+      "{\"type\": \"dragonfly\", \"groups\": 4, \"routers_per_group\": 2, "
+      "\"nodes_per_router\": 2, \"ranks_per_node\": 2}");
+  int nnodes = 32;
+  int ndims = 3;
+  double dim_weights[] = {1. / 32., 1. / 64., 1. / 16.};
+  int dims[3] = {0, 0, 0};
+  std::vector<int> coords(nnodes * ndims);
+  int ret = MPI_Dims_topo_weighted_create(nnodes, ndims, dim_weights, NULL,
+                                          topo.c_str(), dims, coords.data());
+  REQUIRE(ret == MPI_SUCCESS);
+  REQUIRE(dims[0] * dims[1] * dims[2] == nnodes);
+  require_bijection(nnodes, ndims, dims, coords);
+}
+
+TEST_CASE("MPI_Cart_topo_weighted_create returns Cartesian communicator",
+          "[MPI_Cart_topo_weighted_create]") {
+  int rank, size;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  std::string topo = "topo_torus_4x4.json";
+  if (rank == 0) {
+    write_topo_file(topo, "{\"type\": \"torus\", \"extents\": [4, 4]}");
+  }
+  MPI_Barrier(MPI_COMM_WORLD);
+  int ndims = 2;
+  MPI_Comm comm_cart;
+  int ret = MPI_Cart_topo_weighted_create(MPI_COMM_WORLD, ndims,
+                                          MPI_EQUAL_WEIGHTS, NULL,
+                                          topo.c_str(), &comm_cart);
+  REQUIRE(ret == MPI_SUCCESS);
+
+  int status;
+  MPI_Topo_test(comm_cart, &status);
+  REQUIRE(status == MPI_CART);
+  int cart_size;
+  MPI_Comm_size(comm_cart, &cart_size);
+  REQUIRE(cart_size == size);
+
+  /* every rank sits at the position computed for its rank in comm_old */
+  int dims[2] = {0, 0};
+  std::vector<int> coords(size * ndims);
+  ret = MPI_Dims_topo_weighted_create(size, ndims, MPI_EQUAL_WEIGHTS, NULL,
+                                      topo.c_str(), dims, coords.data());
+  REQUIRE(ret == MPI_SUCCESS);
+  int cart_dims[2], cart_periods[2], cart_coords[2];
+  MPI_Cart_get(comm_cart, ndims, cart_dims, cart_periods, cart_coords);
+  int cart_rank;
+  MPI_Comm_rank(comm_cart, &cart_rank);
+  MPI_Cart_coords(comm_cart, cart_rank, ndims, cart_coords);
+  for (int i = 0; i < ndims; i++) {
+    REQUIRE(cart_dims[i] == dims[i]);
+    REQUIRE(cart_coords[i] == coords[rank * ndims + i]);
+  }
+  MPI_Comm_free(&comm_cart);
+}
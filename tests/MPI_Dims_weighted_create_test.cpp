@@ -30,9 +30,13 @@
 #define CATCH_CONFIG_CONSOLE_WIDTH 100
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_session.hpp>
+#include <catch2/generators/catch_generators.hpp>
 
 #include <array>
+#include <climits>
+#include <cmath>
 #include <cstdint>
+#include <vector>
 
 #include "MPI_Dims_weighted_create.h"
 #include <mpi.h>
@@ -161,6 +165,45 @@ TEST_CASE("dim weights", "[MPI_Dims_weighted_create]") {
   }
 }
 
+TEST_CASE("range solver matches single calls",
+          "[MPI_Dims_weighted_create_range]") {
+  // small numbers and a narrow range up to INT_MAX
+  int nnodes_first = GENERATE(1, INT_MAX - 999);
+  int nnodes_last = nnodes_first + 999;
+  int count = nnodes_last - nnodes_first + 1;
+  int ndims = 3;
+  double dim_weights[] = {1. / 40., 1. / 240., 1. / 30.};
+  std::vector<int> dims(ndims * count);
+  std::vector<double> objectives(count);
+  int ret = MPI_Dims_weighted_create_range(nnodes_first, nnodes_last, ndims,
+                                           dim_weights, dims.data(),
+                                           objectives.data());
+  REQUIRE(ret == MPI_SUCCESS);
+
+  for (int k = 0; k < count; k++) {
+    int single_dims[] = {0, 0, 0};
+    MPI_Dims_weighted_create(nnodes_first + k, ndims, dim_weights,
+                             single_dims);
+    double objective = 0.0;
+    for (int d = 0; d < ndims; d++) {
+      REQUIRE(dims[d * count + k] == single_dims[d]);
+      objective += dim_weights[d] * single_dims[d];
+    }
+    REQUIRE(std::abs(objectives[k] - objective) <= 1e-12 * objective);
+  }
+}
+
+TEST_CASE("range solver error checks for wrong input working",
+          "[MPI_Dims_weighted_create_range]") {
+  int dims[3];
+  REQUIRE(MPI_Dims_weighted_create_range(0, 1, 3, MPI_EQUAL_WEIGHTS, dims,
+                                         NULL) != MPI_SUCCESS);
+  REQUIRE(MPI_Dims_weighted_create_range(3, 1, 3, MPI_EQUAL_WEIGHTS, dims,
+                                         NULL) != MPI_SUCCESS);
+  REQUIRE(MPI_Dims_weighted_create_range(1, 1, 0, MPI_EQUAL_WEIGHTS, dims,
+                                         NULL) != MPI_SUCCESS);
+}
+
 // TODO
 TEST_CASE("fixed dimensions stay", "[.][MPI_Dims_weighted_create]") {
   int nnodes = 1;
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2026      High Performance Computing Center Stuttgart,
+ *                         University of Stuttgart.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER NOR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define CATCH_CONFIG_RUNNER
+#define CATCH_CONFIG_CONSOLE_WIDTH 100
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_session.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <chrono>
+#include <vector>
+
+#include "MPI_Dims_weighted_create.h"
+#include "MPI_Dims_weighted_redistribute.h"
+#include <mpi.h>
+
+int main(int argc, char *argv[]) {
+  MPI_Init(&argc, &argv);
+  int result = Catch::Session().run(argc, argv);
+  MPI_Finalize();
+  return result;
+}
+
+TEST_CASE("redistribution error checks for wrong input working",
+          "[MPI_Dims_weighted_redistribute]") {
+  int ndims = 2;
+  int old_dims[] = {2, 4};
+  int global_extents[] = {120, 96};
+  int new_dims[] = {0, 0};
+
+  SECTION("if new_nnodes less than one return failure") {
+    int ret = MPI_Dims_weighted_redistribute(ndims, old_dims, 0,
+                                             MPI_EQUAL_WEIGHTS, global_extents,
+                                             1.0, 0, new_dims, NULL);
+    REQUIRE(ret != MPI_SUCCESS);
+  }
+  SECTION("if old dims are not positive return failure") {
+    int bad_dims[] = {0, 4};
+    int ret = MPI_Dims_weighted_redistribute(ndims, bad_dims, 8,
+                                             MPI_EQUAL_WEIGHTS, global_extents,
+                                             1.0, 0, new_dims, NULL);
+    REQUIRE(ret != MPI_SUCCESS);
+  }
+  SECTION("if rank is outside both grids return failure") {
+    MPI_Redistribution_plan plan;
+    int ret = MPI_Dims_weighted_redistribute(ndims, old_dims, 4,
+                                             MPI_EQUAL_WEIGHTS, global_extents,
+                                             1.0, 8, new_dims, &plan);
+    REQUIRE(ret != MPI_SUCCESS);
+  }
+}
+
+TEST_CASE("redistribution weight trades objective against data movement",
+          "[MPI_Dims_weighted_redistribute]") {
+  int ndims = 2;
+  int old_dims[] = {2, 4};
+  int global_extents[] = {120, 96};
+  double dim_weights[] = {1. / 120., 1. / 96.};
+
+  SECTION("zero weight reproduces MPI_Dims_weighted_create") {
+    int new_dims[] = {0, 0};
+    int ret = MPI_Dims_weighted_redistribute(ndims, old_dims, 8, dim_weights,
+                                             global_extents, 0.0, 0, new_dims,
+                                             NULL);
+    REQUIRE(ret == MPI_SUCCESS);
+    int dims[] = {0, 0};
+    MPI_Dims_weighted_create(8, ndims, dim_weights, dims);
+    REQUIRE(new_dims[0] == dims[0]);
+    REQUIRE(new_dims[1] == dims[1]);
+  }
+  SECTION("large weight keeps the old grid") {
+    int new_dims[] = {0, 0};
+    int ret = MPI_Dims_weighted_redistribute(ndims, old_dims, 8, dim_weights,
+                                             global_extents, 10.0, 0, new_dims,
+                                             NULL);
+    REQUIRE(ret == MPI_SUCCESS);
+    REQUIRE(new_dims[0] == 2);
+    REQUIRE(new_dims[1] == 4);
+  }
+}
+
+TEST_CASE("redistribution with more than three dimensions",
+          "[MPI_Dims_weighted_redistribute]") {
+  int ndims = 4;
+  int old_dims[] = {2, 2, 2, 2};
+  int global_extents[] = {80, 20, 20, 20};
+  double dim_weights[] = {1. / 80., 1. / 20., 1. / 20., 1. / 20.};
+
+  SECTION("zero weight reproduces MPI_Dims_weighted_create") {
+    int new_dims[] = {0, 0, 0, 0};
+    int ret = MPI_Dims_weighted_redistribute(ndims, old_dims, 16, dim_weights,
+                                             global_extents, 0.0, 0, new_dims,
+                                             NULL);
+    REQUIRE(ret == MPI_SUCCESS);
+    int dims[] = {0, 0, 0, 0};
+    MPI_Dims_weighted_create(16, ndims, dim_weights, dims);
+    for (int i = 0; i < ndims; i++) {
+      REQUIRE(new_dims[i] == dims[i]);
+    }
+  }
+  SECTION("large weight keeps the old grid") {
+    int new_dims[] = {0, 0, 0, 0};
+    int ret = MPI_Dims_weighted_redistribute(ndims, old_dims, 16, dim_weights,
+                                             global_extents, 10.0, 0, new_dims,
+                                             NULL);
+    REQUIRE(ret == MPI_SUCCESS);
+    for (int i = 0; i < ndims; i++) {
+      REQUIRE(new_dims[i] == 2);
+    }
+  }
+  SECTION("many dimensions are searched in bounded time") {
+    // enumerating all ordered factorizations took 24 s here
+    std::vector<int> many_old_dims(16, 1), extents(16, 64), new_dims(16, 0);
+    for (int i = 0; i < 12; i++) {
+      many_old_dims[i] = 2;
+    }
+    auto start = std::chrono::steady_clock::now();
+    int ret = MPI_Dims_weighted_redistribute(
+        16, many_old_dims.data(), 65536, MPI_EQUAL_WEIGHTS, extents.data(),
+        1.0, 0, new_dims.data(), NULL);
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    REQUIRE(ret == MPI_SUCCESS);
+    REQUIRE(elapsed.count() < 5.0);
+    int product = 1;
+    for (int i = 0; i < 16; i++) {
+      product *= new_dims[i];
+    }
+    REQUIRE(product == 65536);
+  }
+}
+
+TEST_CASE("redistribution plans are consistent",
+          "[MPI_Dims_weighted_redistribute]") {
+  int ndims = 3;
+  int old_dims[] = {2, 3, 2};
+  int old_nnodes = 12;
+  int global_extents[] = {50, 31, 17};
+  int new_nnodes = GENERATE(5, 8, 12, 18);
+  int max_nnodes = (old_nnodes > new_nnodes) ? old_nnodes : new_nnodes;
+
+  std::vector<MPI_Redistribution_plan> plans(max_nnodes);
+  int new_dims[3];
+  for (int r = 0; r < max_nnodes; r++) {
+    int ret = MPI_Dims_weighted_redistribute(
+        ndims, old_dims, new_nnodes, MPI_EQUAL_WEIGHTS, global_extents, 1.0, r,
+        new_dims, &plans[r]);
+    REQUIRE(ret == MPI_SUCCESS);
+  }
+  REQUIRE(new_dims[0] * new_dims[1] * new_dims[2] == new_nnodes);
+
+  /* every send matches a receive of the same block */
+  long sent = 0, received = 0;
+  for (int r = 0; r < max_nnodes; r++) {
+    const MPI_Redistribution_plan &plan = plans[r];
+    for (int k = 0; k < plan.nsend; k++) {
+      const MPI_Redistribution_plan &peer = plans[plan.send_ranks[k]];
+      int found = 0;
+      for (int l = 0; l < peer.nrecv; l++) {
+        if (peer.recv_ranks[l] == r) {
+          REQUIRE(peer.recv_counts[l] == plan.send_counts[k]);
+          for (int i = 0; i < ndims; i++) {
+            REQUIRE(peer.recv_lo[l * ndims + i] == plan.send_lo[k * ndims + i]);
+            REQUIRE(peer.recv_hi[l * ndims + i] == plan.send_hi[k * ndims + i]);
+          }
+          found++;
+        }
+      }
+      REQUIRE(found == 1);
+      sent += plan.send_counts[k];
+    }
+    for (int k = 0; k < plan.nrecv; k++) {
+      received += plan.recv_counts[k];
+    }
+  }
+  REQUIRE(sent == 50 * 31 * 17);
+  REQUIRE(received == 50 * 31 * 17);
+
+  std::vector<int> sendcounts(max_nnodes), sdispls(max_nnodes),
+      recvcounts(max_nnodes), rdispls(max_nnodes);
+  int ret = MPI_Redistribution_plan_alltoallv(
+      &plans[0], max_nnodes, sendcounts.data(), sdispls.data(),
+      recvcounts.data(), rdispls.data());
+  REQUIRE(ret == MPI_SUCCESS);
+  REQUIRE(sdispls[max_nnodes - 1] + sendcounts[max_nnodes - 1] ==
+          25 * 11 * 9);
+
+  for (int r = 0; r < max_nnodes; r++) {
+    MPI_Redistribution_plan_free(&plans[r]);
+  }
+}
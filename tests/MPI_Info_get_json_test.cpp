@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026      High Performance Computing Center Stuttgart,
+ *                         University of Stuttgart.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER NOR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define CATCH_CONFIG_RUNNER
+#define CATCH_CONFIG_CONSOLE_WIDTH 100
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_session.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include <string>
+#include <vector>
+
+#include "MPI_Info_get_json.h"
+#include "MPI_Info_set_json.h"
+#include <mpi.h>
+
+int main(int argc, char *argv[]) {
+  MPI_Init(&argc, &argv);
+  int result = Catch::Session().run(argc, argv);
+  MPI_Finalize();
+  return result;
+}
+
+static std::string get_json(MPI_Info info) {
+  int buflen = 0;
+  int ret = MPI_Info_get_json(info, &buflen, NULL);
+  REQUIRE(ret == MPI_SUCCESS);
+  std::vector<char> json_str(buflen);
+  ret = MPI_Info_get_json(info, &buflen, json_str.data());
+  REQUIRE(ret == MPI_SUCCESS);
+  return std::string(json_str.data());
+}
+
+TEST_CASE("MPI_Info_get_json of empty info", "[MPI_Info_get_json]") {
+  MPI_Info info;
+  MPI_Info_create(&info);
+  REQUIRE_THAT(get_json(info), Catch::Matchers::Equals("{}"));
+  MPI_Info_free(&info);
+}
+
+TEST_CASE("MPI_Info_get_json get multiple pairs", "[MPI_Info_get_json]") {
+  MPI_Info info;
+  MPI_Info_create(&info);
+  MPI_Info_set(info, "key1", "value1");
+  MPI_Info_set(info, "key2", "a/b \"c\"");
+  REQUIRE_THAT(get_json(info),
+               Catch::Matchers::Equals(
+                   "{\"key1\":\"value1\",\"key2\":\"a/b \\\"c\\\"\"}"));
+  MPI_Info_free(&info);
+}
+
+TEST_CASE("MPI_Info_get_json truncates to buflen", "[MPI_Info_get_json]") {
+  MPI_Info info;
+  MPI_Info_create(&info);
+  MPI_Info_set(info, "key1", "value1");
+  char json_str[5];
+  int buflen = sizeof(json_str);
+  int ret = MPI_Info_get_json(info, &buflen, json_str);
+  REQUIRE(ret == MPI_SUCCESS);
+  REQUIRE(buflen == 18);
+  REQUIRE_THAT(json_str, Catch::Matchers::Equals("{\"ke"));
+  MPI_Info_free(&info);
+}
+
+TEST_CASE("MPI_Info_get_json round trip with MPI_Info_set_json",
+          "[MPI_Info_get_json]") {
+  MPI_Info info;
+  MPI_Info_create(&info);
+  MPI_Info_set(info, "key1", "value1");
+  MPI_Info_set(info, "key2", "value2");
+  std::string json_str = get_json(info);
+
+  MPI_Info copy;
+  MPI_Info_create(&copy);
+  int ret = MPI_Info_set_json(copy, json_str.c_str());
+  REQUIRE(ret == MPI_SUCCESS);
+  REQUIRE_THAT(get_json(copy), Catch::Matchers::Equals(json_str));
+
+  MPI_Info_free(&copy);
+  MPI_Info_free(&info);
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026      High Performance Computing Center Stuttgart,
+ *                         University of Stuttgart.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from this
+ * software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER NOR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define CATCH_CONFIG_RUNNER
+#define CATCH_CONFIG_CONSOLE_WIDTH 100
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_session.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "MPI_Info_snapshot.h"
+#include <mpi.h>
+
+int main(int argc, char *argv[]) {
+  MPI_Init(&argc, &argv);
+  int result = Catch::Session().run(argc, argv);
+  MPI_Finalize();
+  return result;
+}
+
+static std::string get_value(MPI_Info info, const char *key) {
+  int valuelen = 0;
+  int flag = 0;
+  MPI_Info_get_valuelen(info, key, &valuelen, &flag);
+  REQUIRE((flag));
+  std::vector<char> value(valuelen + 1);
+  MPI_Info_get(info, key, valuelen, value.data(), &flag);
+  return std::string(value.data());
+}
+
+TEST_CASE("MPI_Info_snapshot of empty info restores nothing",
+          "[MPI_Info_snapshot]") {
+  MPI_Info info;
+  MPI_Info_create(&info);
+  void *buf = NULL;
+  int size = 0;
+  int ret = MPI_Info_snapshot(info, &size, &buf);
+  REQUIRE(ret == MPI_SUCCESS);
+
+  MPI_Info copy;
+  MPI_Info_create(&copy);
+  ret = MPI_Info_restore(buf, size, copy);
+  REQUIRE(ret == MPI_SUCCESS);
+  int nkeys = -1;
+  MPI_Info_get_nkeys(copy, &nkeys);
+  REQUIRE(nkeys == 0);
+
+  free(buf);
+  MPI_Info_free(&copy);
+  MPI_Info_free(&info);
+}
+
+TEST_CASE("MPI_Info_snapshot round trip", "[MPI_Info_snapshot]") {
+  MPI_Info info;
+  MPI_Info_create(&info);
+  const int nkeys = 1000;
+  for (int i = 0; i < nkeys; i++) {
+    std::string key = "key" + std::to_string(i);
+    std::string value = std::string(i % 17, 'x') + std::to_string(i);
+    MPI_Info_set(info, key.c_str(), value.c_str());
+  }
+  void *buf = NULL;
+  int size = 0;
+  int ret = MPI_Info_snapshot(info, &size, &buf);
+  REQUIRE(ret == MPI_SUCCESS);
+
+  MPI_Info copy;
+  MPI_Info_create(&copy);
+  ret = MPI_Info_restore(buf, size, copy);
+  REQUIRE(ret == MPI_SUCCESS);
+  int copy_nkeys = 0;
+  MPI_Info_get_nkeys(copy, &copy_nkeys);
+  REQUIRE(copy_nkeys == nkeys);
+  for (int i = 0; i < nkeys; i += 99) {
+    std::string key = "key" + std::to_string(i);
+    std::string value = std::string(i % 17, 'x') + std::to_string(i);
+    REQUIRE_THAT(get_value(copy, key.c_str()), Catch::Matchers::Equals(value));
+  }
+
+  free(buf);
+  MPI_Info_free(&copy);
+  MPI_Info_free(&info);
+}
+
+TEST_CASE("MPI_Info_restore rejects invalid buffers", "[MPI_Info_snapshot]") {
+  MPI_Info info;
+  MPI_Info_create(&info);
+  MPI_Info_set(info, "key1", "value1");
+  void *buf = NULL;
+  int size = 0;
+  MPI_Info_snapshot(info, &size, &buf);
+
+  MPI_Info copy;
+  MPI_Info_create(&copy);
+  SECTION("truncated buffer") {
+    REQUIRE(MPI_Info_restore(buf, size - 1, copy) != MPI_SUCCESS);
+  }
+  SECTION("wrong magic") {
+    static_cast<char *>(buf)[0] ^= 1;
+    REQUIRE(MPI_Info_restore(buf, size, copy) != MPI_SUCCESS);
+  }
+
+  free(buf);
+  MPI_Info_free(&copy);
+  MPI_Info_free(&info);
+}